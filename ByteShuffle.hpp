@@ -0,0 +1,175 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Byte-shuffle (transpose) filter for arrays of fixed-endian Int.
+/// @details
+/// Defines ::tjg::byte_shuffle() and ::tjg::byte_unshuffle(), which transpose
+/// an array of Int<T, E> into sizeof(T) byte planes and back, as done by Blosc
+/// before handing data to a general-purpose compressor. Plane 0 always holds
+/// the most significant bytes, so the shuffled stream does not depend on the
+/// byte order of either side: shuffling from, or unshuffling to, either order
+/// is the same single pass with the planes visited in a different order.
+///
+/// The kernels use SSE2 or AVX2 when available (see TJG_INT_SIMD). A block of
+/// 16 elements (32 with AVX2, one group per lane) is transposed with repeated
+/// unpacks: each round of unpacklo/unpackhi over register pairs (j, j+S/2) is
+/// a perfect shuffle of the block's bytes, which rotates the byte index left
+/// by one bit. Four rounds turn element-major order into plane-major;
+/// log2(sizeof(T)) rounds turn it back.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp" // TJG_INT_SIMD
+
+#include <span>       // std::span
+#include <bit>        // std::endian, std::countr_zero
+#include <cstddef>    // std::size_t, std::byte
+
+#if TJG_INT_SIMD && defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace tjg {
+
+namespace detail {
+
+#if TJG_INT_SIMD && defined(__SSE2__)
+inline __m128i unpack_lo8(__m128i a, __m128i b) noexcept
+  { return _mm_unpacklo_epi8(a, b); }
+inline __m128i unpack_hi8(__m128i a, __m128i b) noexcept
+  { return _mm_unpackhi_epi8(a, b); }
+#endif
+
+#if TJG_INT_SIMD && defined(__AVX2__)
+inline __m256i unpack_lo8(__m256i a, __m256i b) noexcept
+  { return _mm256_unpacklo_epi8(a, b); }
+inline __m256i unpack_hi8(__m256i a, __m256i b) noexcept
+  { return _mm256_unpackhi_epi8(a, b); }
+#endif
+
+/// Apply a perfect shuffle to the bytes of v[0..S), rounds times.
+template<std::size_t S, typename V>
+inline void perfect_shuffle(V (&v)[S], int rounds) noexcept {
+  for (int r = 0; r != rounds; ++r) {
+    V t[S];
+    for (std::size_t j = 0; j != S / 2; ++j) {
+      t[2 * j]     = unpack_lo8(v[j], v[j + S / 2]);
+      t[2 * j + 1] = unpack_hi8(v[j], v[j + S / 2]);
+    }
+    for (std::size_t j = 0; j != S; ++j)
+      v[j] = t[j];
+  }
+} // perfect_shuffle
+
+/// Plane holding storage byte b of an Int<T, E>; plane 0 is most significant.
+template<std::size_t S, std::endian E>
+constexpr std::size_t byte_plane(std::size_t b) noexcept
+  { return (E == std::endian::big) ? b : S - 1 - b; }
+
+} // detail
+
+/// Transpose in into sizeof(T) byte planes of in.size() bytes each.
+/// Plane 0 holds the most significant byte of every element.
+/// @param in  elements to shuffle
+/// @param out destination, at least in.size() * sizeof(T) bytes
+template<std::integral T, std::endian E>
+void byte_shuffle(std::span<const Int<T, E>> in, std::span<std::byte> out)
+  noexcept
+{
+  constexpr std::size_t S = sizeof(T);
+  const auto n = in.size();
+  const auto* src = reinterpret_cast<const unsigned char*>(in.data());
+  auto* dst = reinterpret_cast<unsigned char*>(out.data());
+  std::size_t i = 0;
+  if constexpr (S > 1) {
+#if TJG_INT_SIMD && defined(__AVX2__)
+    for (; i + 32 <= n; i += 32) {
+      __m256i v[S];
+      for (std::size_t j = 0; j != S; ++j) {
+        const auto* p = src + i * S + 16 * j;
+        auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*S));
+        v[j] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+      }
+      detail::perfect_shuffle(v, 4);
+      for (std::size_t b = 0; b != S; ++b) {
+        auto* q = dst + detail::byte_plane<S, E>(b) * n + i;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(q), v[b]);
+      }
+    }
+#endif
+#if TJG_INT_SIMD && defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+      __m128i v[S];
+      for (std::size_t j = 0; j != S; ++j) {
+        const auto* p = src + i * S + 16 * j;
+        v[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      }
+      detail::perfect_shuffle(v, 4);
+      for (std::size_t b = 0; b != S; ++b) {
+        auto* q = dst + detail::byte_plane<S, E>(b) * n + i;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(q), v[b]);
+      }
+    }
+#endif
+  }
+  for (; i != n; ++i) {
+    for (std::size_t b = 0; b != S; ++b)
+      dst[detail::byte_plane<S, E>(b) * n + i] = src[i * S + b];
+  }
+} // byte_shuffle
+
+/// Inverse of byte_shuffle(): gather out.size() elements from sizeof(T) byte
+/// planes, writing them directly in byte order E.
+/// @param in  planes, at least out.size() * sizeof(T) bytes
+/// @param out destination elements
+template<std::integral T, std::endian E>
+void byte_unshuffle(std::span<const std::byte> in, std::span<Int<T, E>> out)
+  noexcept
+{
+  constexpr std::size_t S = sizeof(T);
+  const auto n = out.size();
+  const auto* src = reinterpret_cast<const unsigned char*>(in.data());
+  auto* dst = reinterpret_cast<unsigned char*>(out.data());
+  std::size_t i = 0;
+  if constexpr (S > 1) {
+    [[maybe_unused]] constexpr int Rounds = std::countr_zero(S);
+#if TJG_INT_SIMD && defined(__AVX2__)
+    for (; i + 32 <= n; i += 32) {
+      __m256i v[S];
+      for (std::size_t b = 0; b != S; ++b) {
+        const auto* p = src + detail::byte_plane<S, E>(b) * n + i;
+        v[b] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+      }
+      detail::perfect_shuffle(v, Rounds);
+      for (std::size_t j = 0; j != S; ++j) {
+        auto* q = dst + i * S + 16 * j;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(q),
+                         _mm256_castsi256_si128(v[j]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(q + 16 * S),
+                         _mm256_extracti128_si256(v[j], 1));
+      }
+    }
+#endif
+#if TJG_INT_SIMD && defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+      __m128i v[S];
+      for (std::size_t b = 0; b != S; ++b) {
+        const auto* p = src + detail::byte_plane<S, E>(b) * n + i;
+        v[b] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      }
+      detail::perfect_shuffle(v, Rounds);
+      for (std::size_t j = 0; j != S; ++j) {
+        auto* q = dst + i * S + 16 * j;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(q), v[j]);
+      }
+    }
+#endif
+  }
+  for (; i != n; ++i) {
+    for (std::size_t b = 0; b != S; ++b)
+      dst[i * S + b] = src[detail::byte_plane<S, E>(b) * n + i];
+  }
+} // byte_unshuffle
+
+} // tjg
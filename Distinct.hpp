@@ -0,0 +1,235 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Deduplication and distinct counting of fixed-endian Int arrays.
+/// @details
+/// ::tjg::unique() removes adjacent duplicates from a sorted
+/// std::span<Int<T, E>> in place, like std::unique. Equality does not depend
+/// on byte order, so each vector is compared with itself shifted by one lane
+/// on raw storage, without swaps; vectors with no duplicates are stored back
+/// whole, and the others are compacted with the AVX2 permute from Filter.hpp
+/// (32- and 64-bit elements) or lane by lane.
+///
+/// ::tjg::HyperLogLog<E> estimates the number of distinct values in unsorted
+/// data with 2^p one-byte registers and a standard error of about
+/// 1.04 / sqrt(2^p). Values are hashed by their native value, so both byte
+/// orders of a column count alike, and the registers are saved as an image of
+/// Int<std::uint64_t, E> words, so sketches built on different hosts can be
+/// merged. ::tjg::distinct_count() is the one-call form.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+#include "Filter.hpp"
+
+#include <span>       // std::span
+#include <vector>     // std::vector
+#include <algorithm>  // std::max
+#include <cmath>      // std::log, std::ldexp
+#include <utility>    // std::index_sequence
+#include <bit>        // std::endian, std::countl_zero, std::popcount
+#include <cstdint>    // std::uint8_t, std::uint32_t, std::uint64_t
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::invalid_argument
+
+namespace tjg {
+
+/// Remove all but the first of each run of equal elements of s, moving the
+/// kept elements to the front in order.
+/// @return the number of elements kept
+template<std::integral T, std::endian E>
+std::size_t unique(std::span<Int<T, E>> s) noexcept {
+  const auto n = s.size();
+  if (n < 2)
+    return n;
+  T* p = detail::raw_data(s);
+  std::size_t k = 1;
+  std::size_t i = 1;
+#if TJG_INT_SIMD
+  {
+    constexpr auto L = detail::Lanes<T>;
+    constexpr auto All = ~std::uint32_t{0} >> (32 - L);
+    // The previous vector stays in a register: stores may clobber it.
+    auto last = detail::vsplat(p[0]);
+    for (; i + L <= n; i += L) {
+      auto v = detail::vload(p + i);
+      auto prev = [&]<std::size_t... J>(std::index_sequence<J...>) {
+        return __builtin_shufflevector(last, v, (L - 1 + J)...);
+      }(std::make_index_sequence<L>{});
+      last = v;
+      auto keep = detail::vmovemask(v != prev);
+      if (keep == All) {
+        if (k != i)
+          detail::vstore(p + k, v);
+        k += L;
+        continue;
+      }
+#if defined(__AVX2__)
+      if constexpr (sizeof(T) >= 4) {
+        auto m = (sizeof(T) == 4) ? keep : detail::double_bits(keep);
+        detail::vstore(p + k,
+                       detail::compress256(reinterpret_cast<__m256i>(v), m));
+        k += static_cast<std::size_t>(std::popcount(keep));
+        continue;
+      }
+#endif
+      for (; keep != 0; keep &= keep - 1)
+        p[k++] = v[std::countr_zero(keep)];
+    }
+  }
+#endif
+  for (; i != n; ++i) {
+    if (p[i] != p[k - 1])
+      p[k++] = p[i];
+  }
+  return k;
+} // unique
+
+/// HyperLogLog sketch of 2^p registers, 4 <= p <= 18.
+///
+/// Image layout, all words Int<std::uint64_t, E>:
+/// - word 0: precision p
+/// - then 2^p / 8 words of registers, register r in bits 8*(r%8) of word r/8.
+template<std::endian E = std::endian::native>
+class HyperLogLog {
+public:
+  using Word = Int<std::uint64_t, E>;
+  static constexpr std::endian Endian = E;
+  static constexpr std::size_t HeaderWords = 1;
+  static constexpr unsigned DefaultPrecision = 14;
+  static constexpr unsigned MinPrecision = 4;
+  static constexpr unsigned MaxPrecision = 18;
+
+private:
+  unsigned _p = DefaultPrecision;
+  std::vector<std::uint8_t> _reg;
+
+  // Murmur3 64-bit finalizer.
+  static constexpr std::uint64_t _mix(std::uint64_t x) noexcept {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+  }
+
+  static unsigned _checked(unsigned p) {
+    if (p < MinPrecision || p > MaxPrecision)
+      throw std::invalid_argument{"HyperLogLog: precision out of range"};
+    return p;
+  }
+
+  // Precision of an image, after checking that the image matches it.
+  static unsigned _checked(std::span<const Word> image) {
+    if (image.size() < HeaderWords)
+      throw std::invalid_argument{"HyperLogLog: image too short"};
+    const auto p = image[0].value();
+    if (p < MinPrecision || p > MaxPrecision
+        || image.size() != image_size(static_cast<unsigned>(p)))
+    {
+      throw std::invalid_argument{"HyperLogLog: bad image"};
+    }
+    return static_cast<unsigned>(p);
+  }
+
+public:
+  /// Number of image words for precision p.
+  static constexpr std::size_t image_size(unsigned p) noexcept
+    { return HeaderWords + (std::size_t{1} << p) / 8; }
+
+  /// @name Constructors
+  /// @{
+  /// Empty sketch of precision p.
+  /// @throws std::invalid_argument unless MinPrecision <= p <= MaxPrecision
+  explicit HyperLogLog(unsigned p = DefaultPrecision)
+    : _p{_checked(p)}, _reg(std::size_t{1} << p) { }
+
+  /// Load a sketch from an image made by image(), e.g. one read from a file.
+  /// @throws std::invalid_argument if the precision is out of range or the
+  /// image is not image_size() words long for it
+  explicit HyperLogLog(std::span<const Word> image)
+    : HyperLogLog{_checked(image)}
+  {
+    for (std::size_t r = 0; r != _reg.size(); ++r) {
+      auto w = image[HeaderWords + r / 8].value();
+      _reg[r] = static_cast<std::uint8_t>(w >> (8 * (r % 8)));
+    }
+  }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] unsigned precision() const noexcept { return _p; }
+
+  /// Estimated number of distinct values added.
+  [[nodiscard]] double estimate() const noexcept {
+    const auto m = static_cast<double>(_reg.size());
+    double sum = 0;
+    std::size_t zeros = 0;
+    for (auto r: _reg) {
+      sum += std::ldexp(1.0, -r);
+      zeros += (r == 0);
+    }
+    const double alpha = 0.7213 / (1 + 1.079 / m);
+    double e = alpha * m * m / sum;
+    if (e <= 2.5 * m && zeros != 0) // small range: linear counting
+      e = m * std::log(m / static_cast<double>(zeros));
+    return e;
+  } // estimate
+
+  /// Save the registers as a fixed-endian image.
+  [[nodiscard]] std::vector<Word> image() const {
+    auto img = std::vector<Word>(image_size(_p));
+    img[0] = std::uint64_t{_p};
+    for (std::size_t w = 0; w != _reg.size() / 8; ++w) {
+      std::uint64_t x = 0;
+      for (std::size_t b = 0; b != 8; ++b)
+        x |= std::uint64_t{_reg[8 * w + b]} << (8 * b);
+      img[HeaderWords + w] = x;
+    }
+    return img;
+  } // image
+  /// @}
+
+  /// @name Modifiers
+  /// @{
+  /// Add a value by its 64-bit hash.
+  void add_hash(std::uint64_t h) noexcept {
+    auto r = h >> (64 - _p);
+    auto rest = (h << _p) | (std::uint64_t{1} << (_p - 1)); // caps the rank
+    auto rank = static_cast<std::uint8_t>(std::countl_zero(rest) + 1);
+    _reg[r] = std::max(_reg[r], rank);
+  }
+
+  /// Add every element of values.
+  template<std::integral T, std::endian E2>
+  void add(std::span<const Int<T, E2>> values) noexcept {
+    for (auto x: values)
+      add_hash(_mix(static_cast<std::uint64_t>(x.value())));
+  }
+
+  /// Add the values counted by other.
+  /// @throws std::invalid_argument if other has a different precision
+  void merge(const HyperLogLog& other) {
+    if (other._p != _p)
+      throw std::invalid_argument{"HyperLogLog: merge of unequal precisions"};
+    for (std::size_t r = 0; r != _reg.size(); ++r)
+      _reg[r] = std::max(_reg[r], other._reg[r]);
+  }
+  /// @}
+}; // HyperLogLog
+
+/// Estimate the number of distinct values of an unsorted span with a
+/// HyperLogLog sketch of 2^p registers.
+/// @throws std::invalid_argument as HyperLogLog(p)
+template<std::integral T, std::endian E>
+double distinct_count(std::span<const Int<T, E>> values,
+                      unsigned p = HyperLogLog<>::DefaultPrecision)
+{
+  auto hll = HyperLogLog<>{p};
+  hll.add(values);
+  return hll.estimate();
+}
+
+} // tjg
@@ -0,0 +1,103 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Byte order chosen at run time: one dispatch per file.
+/// @details
+/// Formats such as TIFF ("II"/"MM"), pcap and ELF declare their byte order in
+/// a header, so E of Int<T, E> is only known at run time. Branching on it at
+/// every field would undo the point of Int. Instead ::tjg::with_endian()
+/// branches once and calls a template lambda instantiated for both orders:
+///
+/// @code
+///   if (auto e = endian_from_magic<std::uint32_t>(file, 0xa1b2c3d4))
+///     with_endian(*e, [&]<std::endian E> { decode<E>(file); });
+/// @endcode
+///
+/// so the whole decoder runs with a compile-time E. ::tjg::DynIntReader reads
+/// single fields with the run-time order, for cold paths such as the header
+/// itself, where a branch per field costs nothing.
+
+#pragma once
+#include "Int.hpp"
+
+#include <span>       // std::span
+#include <optional>   // std::optional
+#include <bit>        // std::endian, std::byteswap
+#include <utility>    // std::forward
+#include <cstring>    // std::memcpy
+#include <cstddef>    // std::byte, std::size_t
+
+namespace tjg {
+
+/// Return fn.template operator()<e>(), with e as a constant; fn is
+/// instantiated for both byte orders, and must return the same type for both.
+template<typename Fn>
+decltype(auto) with_endian(std::endian e, Fn&& fn) {
+  if (e == std::endian::big)
+    return fn.template operator()<std::endian::big>();
+  else
+    return fn.template operator()<std::endian::little>();
+}
+
+/// Byte order in which the first sizeof(T) bytes of bytes hold magic, or none
+/// if they hold it in neither or in both (or bytes is too short). For
+/// example, a pcap file starts with the 32-bit magic 0xa1b2c3d4. A magic that
+/// reads the same in both orders, such as TIFF's "II" and "MM" marks, tells
+/// nothing and yields none: compare such marks byte by byte, and check TIFF's
+/// 42 at offset 2 only once the order is known.
+template<std::integral T>
+std::optional<std::endian> endian_from_magic(std::span<const std::byte> bytes,
+                                             T magic) noexcept
+{
+  if (bytes.size() < sizeof(T))
+    return std::nullopt;
+  T x;
+  std::memcpy(&x, bytes.data(), sizeof(x));
+  const bool big    = (Int<T, std::endian::big>::Raw(x).value() == magic);
+  const bool little = (Int<T, std::endian::little>::Raw(x).value() == magic);
+  if (big == little)
+    return std::nullopt;
+  return big ? std::endian::big : std::endian::little;
+} // endian_from_magic
+
+/// Reader of integers at byte offsets of a buffer, in a byte order chosen at
+/// run time. Every read branches on the order; hot loops should use
+/// with_endian() instead.
+class DynIntReader {
+  std::span<const std::byte> _bytes;
+  std::endian _endian = std::endian::native;
+
+public:
+  /// @name Constructors
+  /// @{
+  DynIntReader() = default;
+
+  /// Read bytes, which must outlive the reader, in byte order e.
+  DynIntReader(std::span<const std::byte> bytes, std::endian e) noexcept
+    : _bytes{bytes}, _endian{e} { }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] std::endian endian() const noexcept { return _endian; }
+  [[nodiscard]] std::span<const std::byte> bytes() const noexcept
+    { return _bytes; }
+  [[nodiscard]] std::size_t size() const noexcept { return _bytes.size(); }
+  /// @}
+
+  /// Value of the T at byte offset, which need not be aligned;
+  /// offset + sizeof(T) must not exceed size().
+  template<std::integral T>
+  [[nodiscard]] T read(std::size_t offset) const noexcept {
+    T x;
+    std::memcpy(&x, _bytes.data() + offset, sizeof(x));
+    return (_endian == std::endian::native) ? x : std::byteswap(x);
+  }
+
+  /// Call fn.template operator()<endian()>(), as with_endian().
+  template<typename Fn>
+  decltype(auto) visit(Fn&& fn) const
+    { return with_endian(_endian, std::forward<Fn>(fn)); }
+}; // DynIntReader
+
+} // tjg
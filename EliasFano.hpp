@@ -0,0 +1,209 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Elias-Fano encoding of sorted integer sequences in fixed-endian words.
+/// @details
+/// Defines ::tjg::EliasFano<E>, a read-only view over an Elias-Fano image made
+/// of Int<std::uint64_t, E> words. Each value is split into l low bits, kept
+/// in a packed array, and high bits, kept in unary in a ::tjg::RankSelect
+/// bitvector. A sequence of n values no larger than m takes about
+/// n * (2 + log2(m/n)) bits and supports random access, next_geq() and bulk
+/// decoding straight from a memory-mapped image.
+
+#pragma once
+#include "Int.hpp"
+#include "RankSelect.hpp"
+
+#include <span>       // std::span
+#include <vector>     // std::vector
+#include <bit>        // std::endian, std::bit_width, std::countr_zero
+#include <cstdint>    // std::uint64_t
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::invalid_argument
+
+namespace tjg {
+
+/// Read-only Elias-Fano view over a fixed-endian image.
+///
+/// Image layout, all words Int<std::uint64_t, E>:
+/// - word 0: number of values n
+/// - word 1: largest value m (zero if n is zero)
+/// - word 2: number of low bits l
+/// - then ceil(n*l/64) words of packed low bits (value i at bit i*l)
+/// - then a RankSelect<E> image of the n + (m >> l) + 1 high bits.
+///
+/// The high bits hold n ones and (m >> l) + 1 zeros, and l makes the ones at
+/// least a third of them, so the select samples of RankSelect give
+/// operator[], next_geq() and the start of decode() constant time. Only when
+/// l is 0 and many values repeat are the zeros sparse enough for next_geq()
+/// to search more than a few blocks, O(log n) at worst.
+template<std::endian E = std::endian::native>
+class EliasFano {
+public:
+  using Word = Int<std::uint64_t, E>;
+  using Bits = RankSelect<E>;
+  static constexpr std::endian Endian = E;
+  static constexpr std::size_t HeaderWords = 3;
+
+private:
+  std::span<const Word> _lower;
+  Bits          _upper;
+  std::size_t   _size = 0;
+  unsigned      _l    = 0;
+  std::uint64_t _mask = 0;
+
+  static constexpr unsigned _lowBits(std::size_t n, std::uint64_t m) noexcept {
+    if (n == 0 || m / n == 0)
+      return 0;
+    return static_cast<unsigned>(std::bit_width(m / n)) - 1;
+  }
+
+  static constexpr std::size_t _lowerWords(std::size_t n, unsigned l) noexcept
+    { return (n * l + 63) / 64; }
+
+  static constexpr std::size_t _upperBits(std::size_t n, std::uint64_t m,
+                                          unsigned l) noexcept
+    { return n + static_cast<std::size_t>(m >> l) + 1; }
+
+  std::uint64_t _low(std::size_t i) const noexcept {
+    if (_l == 0)
+      return 0;
+    auto bit = i * _l;
+    auto w = bit / 64;
+    auto s = static_cast<unsigned>(bit % 64);
+    auto x = _lower[w].value() >> s;
+    if (s + _l > 64)
+      x |= _lower[w + 1].value() << (64 - s);
+    return x & _mask;
+  }
+
+  template<typename Get>
+  static std::vector<Word> _encode(std::size_t n, Get get) {
+    std::uint64_t m = n ? get(n - 1) : 0;
+    auto l = _lowBits(n, m);
+    auto nlower = _lowerWords(n, l);
+    auto nupper = _upperBits(n, m, l);
+    auto image = std::vector<Word>(HeaderWords + nlower
+                                   + Bits::image_size(nupper));
+    image[0] = std::uint64_t{n};
+    image[1] = m;
+    image[2] = l;
+    auto lower = std::vector<std::uint64_t>(nlower + 1);
+    auto upper = std::vector<std::uint64_t>((nupper + 63) / 64);
+    auto mask = (l == 0) ? std::uint64_t{0} : ~std::uint64_t{0} >> (64 - l);
+    for (std::size_t i = 0; i != n; ++i) {
+      std::uint64_t x = get(i);
+      if (l != 0) {
+        auto bit = i * l;
+        auto s = bit % 64;
+        lower[bit / 64] |= (x & mask) << s;
+        if (s + l > 64)
+          lower[bit / 64 + 1] |= (x & mask) >> (64 - s);
+      }
+      auto hi = static_cast<std::size_t>(x >> l) + i;
+      upper[hi / 64] |= std::uint64_t{1} << (hi % 64);
+    }
+    for (std::size_t w = 0; w != nlower; ++w)
+      image[HeaderWords + w] = lower[w];
+    Bits::encode(upper, nupper,
+                 std::span<Word>{image}.subspan(HeaderWords + nlower));
+    return image;
+  } // _encode
+
+public:
+  /// Encode a non-decreasing sequence of unsigned fixed-endian values.
+  template<std::unsigned_integral T, std::endian E2>
+  static std::vector<Word> encode(std::span<const Int<T, E2>> values) {
+    return _encode(values.size(),
+                   [&](std::size_t i) { return std::uint64_t{values[i]}; });
+  }
+
+  /// Encode a non-decreasing sequence of unsigned native values.
+  template<std::unsigned_integral T>
+  static std::vector<Word> encode(std::span<const T> values) {
+    return _encode(values.size(),
+                   [&](std::size_t i) { return std::uint64_t{values[i]}; });
+  }
+
+  /// @name Constructors
+  /// @{
+  constexpr EliasFano() noexcept = default;
+
+  /// View an existing image, e.g. one that was memory-mapped from a file.
+  /// The image must outlive the view.
+  /// @throws std::invalid_argument if the image is too short for its header
+  /// and low bits, its high bits are not a valid RankSelect image (see
+  /// RankSelect()) of n ones, or l is not less than 64
+  explicit EliasFano(std::span<const Word> image) {
+    if (image.size() < HeaderWords)
+      throw std::invalid_argument{"EliasFano: image too short"};
+    const auto n = image[0].value();
+    const auto l = image[2].value();
+    const auto room = (image.size() - HeaderWords) * 64; // bits for low bits
+    if (l >= 64 || (l != 0 && n > room / l))
+      throw std::invalid_argument{"EliasFano: bad image"};
+    _size = static_cast<std::size_t>(n);
+    _l = static_cast<unsigned>(l);
+    _mask = (_l == 0) ? 0 : ~std::uint64_t{0} >> (64 - _l);
+    auto nlower = _lowerWords(_size, _l);
+    _lower = image.subspan(HeaderWords, nlower);
+    _upper = Bits{image.subspan(HeaderWords + nlower)};
+    if (_upper.count() != _size)
+      throw std::invalid_argument{"EliasFano: bad image"};
+  }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] std::size_t size()  const noexcept { return _size; }
+  [[nodiscard]] bool        empty() const noexcept { return _size == 0; }
+
+  /// Return value i, which must be less than size().
+  [[nodiscard]] std::uint64_t operator[](std::size_t i) const noexcept {
+    auto hi = static_cast<std::uint64_t>(_upper.select1(i) - i);
+    return (hi << _l) | _low(i);
+  }
+  /// @}
+
+  /// Return the index of the first value not less than x, or size() if every
+  /// value is less than x.
+  [[nodiscard]] std::size_t next_geq(std::uint64_t x) const noexcept {
+    auto hx = static_cast<std::size_t>(x >> _l);
+    auto zeros = _upper.size() - _upper.count();
+    if (hx >= zeros)
+      return _size;
+    // Bucket hx starts just after the zero that ends bucket hx-1.
+    auto pos = (hx == 0) ? std::size_t{0} : _upper.select0(hx - 1) + 1;
+    auto i = pos - hx;
+    auto xl = x & _mask;
+    for (; _upper.test(pos); ++pos, ++i) {
+      if (_low(i) >= xl)
+        return i;
+    }
+    return i; // first value of a later bucket, or size()
+  } // next_geq
+
+  /// Decode out.size() values starting at index first, which must not run
+  /// past size(). Each value must fit in T.
+  template<std::integral T, std::endian E2>
+  void decode(std::span<Int<T, E2>> out, std::size_t first = 0) const noexcept
+  {
+    if (out.empty())
+      return;
+    auto pos = _upper.select1(first);
+    auto k = pos / 64;
+    auto bits = _upper.word(k) & (~std::uint64_t{0} << (pos % 64));
+    auto i = first;
+    for (auto& v: out) {
+      while (bits == 0)
+        bits = _upper.word(++k);
+      pos = k * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+      bits &= bits - 1;
+      auto hi = static_cast<std::uint64_t>(pos - i);
+      v = Int<T, E2>{narrow_cast<T>((hi << _l) | _low(i))};
+      ++i;
+    }
+  } // decode
+}; // EliasFano
+
+} // tjg
@@ -0,0 +1,76 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief std::mdspan access to fixed-endian Int arrays, and bulk tile copies.
+/// @details
+/// ::tjg::endian_accessor<T, E> is an mdspan accessor policy whose data handle
+/// points to Int<T, E> storage and whose access() returns the native value, so
+///
+/// @code
+///   std::mdspan<const std::uint16_t, std::dextents<std::size_t, 2>,
+///               std::layout_right, endian_accessor<std::uint16_t, big>>
+///     image{pixels, height, width};
+/// @endcode
+///
+/// indexes big-endian samples (a FITS image, say) as plain integers. It
+/// needs nothing from <mdspan> itself, so it also serves
+/// std::experimental::mdspan where the standard library lacks std::mdspan.
+///
+/// Per-element access swaps one element at a time. ::tjg::copy_to_native()
+/// instead decodes a contiguous row, or a tile of rows a stride apart, a
+/// vector at a time into a native array; with layout_right the tile at
+/// (r, c) starts at image.data_handle() + image.mapping()(r, c), and its
+/// stride is image.stride(0).
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <bit>        // std::endian
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// mdspan accessor policy reading native T from Int<T, E> storage. Read-only:
+/// use it with an element type of const T.
+template<std::integral T, std::endian E = std::endian::native>
+struct endian_accessor {
+  using offset_policy    = endian_accessor;
+  using element_type     = const T;
+  using reference        = T;
+  using data_handle_type = const Int<T, E>*;
+
+  constexpr endian_accessor() noexcept = default;
+
+  constexpr reference access(data_handle_type p, std::size_t i) const noexcept
+    { return p[i].value(); }
+
+  constexpr data_handle_type offset(data_handle_type p, std::size_t i)
+    const noexcept
+    { return p + i; }
+}; // endian_accessor
+
+/// @name Bulk decoding
+/// @{
+/// Copy a contiguous run, such as a row, to out, which must have in.size()
+/// elements, in native order.
+template<std::integral T, std::endian E>
+void copy_to_native(std::span<const Int<T, E>> in, std::span<T> out) noexcept
+  { detail::copy_native<E>(detail::raw_data(in), out.data(), in.size()); }
+
+/// Copy the rows x cols tile at tile, whose rows start stride elements apart,
+/// to out, which must have rows * cols elements, packed row after row in
+/// native order.
+template<std::integral T, std::endian E>
+void copy_to_native(const Int<T, E>* tile, std::size_t rows, std::size_t cols,
+                    std::size_t stride, std::span<T> out) noexcept
+{
+  for (std::size_t r = 0; r != rows; ++r) {
+    copy_to_native(std::span<const Int<T, E>>{tile + r * stride, cols},
+                   out.subspan(r * cols, cols));
+  }
+}
+/// @}
+
+} // tjg
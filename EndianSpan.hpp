@@ -0,0 +1,234 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Typed view of fixed-endian Int arrays in raw byte buffers.
+/// @details
+/// ::tjg::EndianSpan<T, E> views a std::span<std::byte> (or, for const T, a
+/// std::span<const std::byte>) from a file or socket as an array of
+/// Int<T, E>, without copying it and without casting a pointer that may be
+/// misaligned. Alignment is checked once, at construction. An aligned buffer
+/// is given object lifetime with std::start_lifetime_as_array where the
+/// library has it (std::launder otherwise) and is handed whole to the
+/// std::span kernels of IntSpan.hpp. A misaligned one is run through the same
+/// kernels a block at a time, each block copied to an aligned buffer on the
+/// stack with memcpy (and copied back, for the in-place operations), so no
+/// kernel ever sees a misaligned Int.
+///
+/// for_each_block() exposes the same choice to any other span kernel, such as
+/// the filters and histograms.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>         // std::span
+#include <algorithm>    // std::min, std::max
+#include <memory>       // std::start_lifetime_as_array
+#include <new>          // std::launder
+#include <type_traits>  // std::conditional_t, std::is_const_v, ...
+#include <bit>          // std::endian
+#include <cstring>      // std::memcpy
+#include <limits>       // std::numeric_limits
+#include <cstdint>      // std::uintptr_t
+#include <cstddef>      // std::byte, std::size_t
+
+namespace tjg {
+
+/// View of the bytes of a buffer as Int<std::remove_const_t<T>, E>, read-only
+/// if T is const. A trailing partial element is not part of the view.
+template<typename T, std::endian E = std::endian::native>
+requires std::integral<std::remove_const_t<T>>
+class EndianSpan {
+public:
+  using value_type   = Int<std::remove_const_t<T>, E>;
+  using element_type = std::conditional_t<std::is_const_v<T>,
+                                          const value_type, value_type>;
+  using byte_type    = std::conditional_t<std::is_const_v<T>,
+                                          const std::byte, std::byte>;
+  using Native = std::remove_const_t<T>;
+  static constexpr std::endian Endian = E;
+
+  /// Elements per block of the misaligned path; a multiple of 64, so
+  /// per-block filter bitmasks line up with whole-array ones.
+  static constexpr std::size_t Block = 2048;
+
+private:
+  byte_type* _data = nullptr;
+  std::size_t _size = 0;
+  bool _aligned = true;
+
+  // Copy m elements from i on into aligned scratch, and return them as Int.
+  // The scratch is raw Native, so Int's zero initializer does not clear it
+  // on every call.
+  value_type* _load(Native* buf, std::size_t i, std::size_t m) const noexcept {
+    constexpr auto S = sizeof(value_type);
+    std::memcpy(buf, _data + i * S, m * S);
+#if defined(__cpp_lib_start_lifetime_as)
+    return std::start_lifetime_as_array<value_type>(buf, m);
+#else
+    return std::launder(reinterpret_cast<value_type*>(buf));
+#endif
+  }
+
+  // Copy m elements from scratch back to i on.
+  void _store(const value_type* buf, std::size_t i, std::size_t m)
+    const noexcept
+  {
+    constexpr auto S = sizeof(value_type);
+    std::memcpy(_data + i * S, buf, m * S);
+  }
+
+  // Call fn(block, offset) over the whole view or, if misaligned, over
+  // aligned copies of each Block elements, stored back if Write.
+  template<bool Write, typename Fn>
+  void _run(Fn&& fn) const {
+    using Elem = std::conditional_t<Write, value_type, const value_type>;
+    if (_aligned) {
+      fn(std::span<Elem>{span()}, std::size_t{0});
+      return;
+    }
+    alignas(64) Native buf[Block];
+    for (std::size_t i = 0; i < _size; i += Block) {
+      const auto m = std::min(Block, _size - i);
+      auto* p = _load(buf, i, m);
+      fn(std::span<Elem>{p, m}, i);
+      if constexpr (Write)
+        _store(p, i, m);
+    }
+  } // _run
+
+public:
+  /// @name Constructors
+  /// @{
+  EndianSpan() = default;
+
+  /// View bytes, which must outlive the view.
+  explicit EndianSpan(std::span<byte_type> bytes) noexcept
+    : _data{bytes.data()}
+    , _size{bytes.size() / sizeof(value_type)}
+    , _aligned{reinterpret_cast<std::uintptr_t>(bytes.data())
+                 % alignof(value_type) == 0}
+  {
+#if defined(__cpp_lib_start_lifetime_as)
+    if (_aligned && _size != 0)
+      std::start_lifetime_as_array<value_type>(_data, _size);
+#endif
+  }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] std::size_t size() const noexcept { return _size; }
+  [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+  [[nodiscard]] std::size_t size_bytes() const noexcept
+    { return _size * sizeof(value_type); }
+
+  /// True if the elements are aligned, so that span() may be called.
+  [[nodiscard]] bool aligned() const noexcept { return _aligned; }
+
+  /// The elements as a std::span; only for an aligned() view.
+  [[nodiscard]] std::span<element_type> span() const noexcept
+    { return {std::launder(reinterpret_cast<element_type*>(_data)), _size}; }
+
+  /// Native value of element i.
+  [[nodiscard]] Native operator[](std::size_t i) const noexcept {
+    Native x;
+    return _load(&x, i, 1)->value();
+  }
+  /// @}
+
+  /// Call fn(block, offset) for consecutive blocks of elements covering the
+  /// view, where block is a std::span<element_type> and offset is the index
+  /// of its first element: once for an aligned view, else once per Block
+  /// elements. For a mutable view, changes to a block are stored back.
+  template<typename Fn>
+  void for_each_block(Fn fn) const { _run<!std::is_const_v<T>>(fn); }
+
+  /// @name Queries
+  /// As the std::span functions of IntSpan.hpp.
+  /// @{
+  [[nodiscard]] MinMax<Native> min_max() const noexcept {
+    auto r = MinMax<Native>{std::numeric_limits<Native>::max(),
+                            std::numeric_limits<Native>::min()};
+    _run<false>([&](std::span<const value_type> s, std::size_t) {
+      auto b = ::tjg::min_max(s);
+      r.min = std::min(r.min, b.min);
+      r.max = std::max(r.max, b.max);
+    });
+    return r;
+  } // min_max
+
+  [[nodiscard]] std::size_t find_not(value_type value) const noexcept {
+    if (_aligned)
+      return ::tjg::find_not(std::span<const value_type>{span()}, value);
+    alignas(64) Native buf[Block];
+    for (std::size_t i = 0; i < _size; i += Block) {
+      const auto m = std::min(Block, _size - i);
+      auto* p = _load(buf, i, m);
+      auto k = ::tjg::find_not(std::span<const value_type>{p, m}, value);
+      if (k != m)
+        return i + k;
+    }
+    return _size;
+  } // find_not
+
+  /// Copy the elements to out, which must have size() elements, in its own
+  /// byte order. A change of order is a vector byte swap in one pass when
+  /// aligned(), else in place in out after a plain copy.
+  template<std::endian E2>
+  void copy_to(std::span<Int<Native, E2>> out) const noexcept {
+    if (_size == 0)
+      return;
+    auto* q = detail::raw_data(out);
+    if constexpr (E2 == E) {
+      std::memcpy(q, _data, size_bytes());
+    } else {
+      // One of E and E2 is native, so the conversion is a swap either way.
+      constexpr auto Swap = ~std::endian::native;
+      if (_aligned) {
+        detail::copy_native<Swap>(detail::raw_data(span()), q, _size);
+      } else {
+        std::memcpy(q, _data, size_bytes());
+        detail::copy_native<Swap>(q, q, _size);
+      }
+    }
+  } // copy_to
+  /// @}
+
+  /// @name In-place operations
+  /// As the std::span functions of IntSpan.hpp; only for a mutable view.
+  /// @{
+  void fill(Native value) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::fill(s, value); }); }
+
+  void add(Native k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::add(s, k); }); }
+
+  void sub(Native k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::sub(s, k); }); }
+
+  void mul(Native k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::mul(s, k); }); }
+
+  void shift_left(unsigned k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::shift_left(s, k); }); }
+
+  void shift_right(unsigned k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::shift_right(s, k); }); }
+
+  void clamp(Native lo, Native hi) const noexcept
+    requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::clamp(s, lo, hi); }); }
+
+  void bit_and(Native k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::bit_and(s, k); }); }
+
+  void bit_or(Native k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::bit_or(s, k); }); }
+
+  void bit_xor(Native k) const noexcept requires (!std::is_const_v<T>)
+    { _run<true>([=](auto s, std::size_t) { ::tjg::bit_xor(s, k); }); }
+  /// @}
+}; // EndianSpan
+
+} // tjg
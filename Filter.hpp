@@ -0,0 +1,273 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Vectorized predicate evaluation over fixed-endian Int columns.
+/// @details
+/// Defines ::tjg::filter_lt(), filter_le(), filter_eq() and filter_between(),
+/// which evaluate a predicate against every element of a
+/// std::span<const Int<T, E>> and write a packed selection bitmask: bit i%64
+/// of bits[i/64] is set when element i matches. Ordered predicates keep their
+/// constants native and byte-swap each loaded vector with one shuffle;
+/// filter_eq() instead swaps its constant once and compares raw storage, with
+/// no shuffles at all. ::tjg::select_indices() turns a bitmask into a list of
+/// row numbers, and ::tjg::compact() copies the selected elements themselves,
+/// optionally changing their byte order on the way. compact() uses the
+/// AVX-512 compress instructions when available (VBMI2 for 8- and 16-bit
+/// elements), or an AVX2 lane permute driven by a 256-entry table for 32- and
+/// 64-bit elements.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <algorithm>  // std::min
+#include <array>      // std::array
+#include <bit>        // std::endian, std::popcount, std::countr_zero
+#include <cstring>    // std::memcpy
+#include <cstdint>    // std::uint32_t, std::uint64_t
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+namespace detail {
+
+/// Write a selection bitmask for in. vpred is applied to whole vectors and
+/// spred to single elements; both see native values, or raw storage if Raw.
+/// Bits past in.size() in the last word are cleared. Returns the number of
+/// selected elements.
+template<bool Raw, std::integral T, std::endian E,
+         typename VPred, typename SPred>
+std::size_t filter_bits(std::span<const Int<T, E>> in,
+                        std::span<std::uint64_t> bits,
+                        [[maybe_unused]] VPred vpred, SPred spred) noexcept
+{
+  const T* p = raw_data(in);
+  const auto n = in.size();
+  std::size_t count = 0;
+  std::size_t i = 0;
+#if TJG_INT_SIMD
+  constexpr auto L = Lanes<T>;
+  for (; i + 64 <= n; i += 64) {
+    std::uint64_t w = 0;
+    for (std::size_t j = 0; j != 64; j += L) {
+      auto v = vload(p + i + j);
+      if constexpr (!Raw)
+        v = vnative<E>(v);
+      w |= std::uint64_t{vmovemask(vpred(v))} << j;
+    }
+    bits[i / 64] = w;
+    count += static_cast<std::size_t>(std::popcount(w));
+  }
+#endif
+  for (; i < n; i += 64) {
+    std::uint64_t w = 0;
+    auto m = std::min<std::size_t>(64, n - i);
+    for (std::size_t k = 0; k != m; ++k) {
+      T x = Raw ? p[i + k] : in[i + k].value();
+      w |= std::uint64_t{spred(x)} << k;
+    }
+    bits[i / 64] = w;
+    count += static_cast<std::size_t>(std::popcount(w));
+  }
+  return count;
+} // filter_bits
+
+/// Mask of the low L bits, 0 < L <= 64.
+template<std::size_t L>
+inline constexpr std::uint64_t LowBits = ~std::uint64_t{0} >> (64 - L);
+
+#if TJG_INT_SIMD && defined(__AVX512F__) && defined(__AVX512BW__)
+/// True if compress512<S> exists.
+template<std::size_t S>
+inline constexpr bool HasCompress512 =
+#if defined(__AVX512VBMI2__)
+    true;
+#else
+    (S >= 4);
+#endif
+
+/// Move the lanes of v selected by m to the bottom, zeroing the rest.
+template<std::size_t S>
+inline __m512i compress512(__m512i v, std::uint64_t m) noexcept {
+  if constexpr (S == 8)
+    return _mm512_maskz_compress_epi64(static_cast<__mmask8>(m), v);
+  if constexpr (S == 4)
+    return _mm512_maskz_compress_epi32(static_cast<__mmask16>(m), v);
+#if defined(__AVX512VBMI2__)
+  if constexpr (S == 2)
+    return _mm512_maskz_compress_epi16(static_cast<__mmask32>(m), v);
+  if constexpr (S == 1)
+    return _mm512_maskz_compress_epi8(static_cast<__mmask64>(m), v);
+#endif
+} // compress512
+#endif
+
+#if TJG_INT_SIMD && defined(__AVX2__)
+/// Byte k of CompressLut[m] is the position of the k-th set bit of m, for
+/// _mm256_permutevar8x32_epi32.
+inline constexpr auto CompressLut = [] {
+  std::array<std::uint64_t, 256> lut{};
+  for (unsigned m = 0; m != 256; ++m) {
+    unsigned k = 0;
+    for (unsigned b = 0; b != 8; ++b) {
+      if ((m >> b) & 1)
+        lut[m] |= std::uint64_t{b} << (8 * k++);
+    }
+  }
+  return lut;
+}();
+
+/// Move the 32-bit lanes of v selected by m to the bottom.
+inline __m256i compress256(__m256i v, std::uint64_t m) noexcept {
+  auto idx = _mm256_cvtepu8_epi32(
+                _mm_cvtsi64_si128(static_cast<long long>(CompressLut[m])));
+  return _mm256_permutevar8x32_epi32(v, idx);
+}
+
+/// Widen each of the low 4 bits of m to 2 bits, so that a mask of 64-bit
+/// lanes selects pairs of 32-bit lanes.
+constexpr std::uint64_t double_bits(std::uint64_t m) noexcept {
+  m = (m | (m << 2)) & 0x33;
+  m = (m | (m << 1)) & 0x55;
+  return m * 3;
+}
+#endif
+
+} // detail
+
+/// @name Filters
+/// Each writes a selection bitmask of (in.size() + 63) / 64 words to bits and
+/// returns the number of selected elements.
+/// @{
+/// Select elements less than x.
+template<std::integral T, std::endian E>
+std::size_t filter_lt(std::span<const Int<T, E>> in, T x,
+                      std::span<std::uint64_t> bits) noexcept
+{
+  return detail::filter_bits<false>(in, bits,
+                    [=](auto v) { return v < decltype(v){} + x; },
+                    [=](T v) { return v < x; });
+}
+
+/// Select elements less than or equal to x.
+template<std::integral T, std::endian E>
+std::size_t filter_le(std::span<const Int<T, E>> in, T x,
+                      std::span<std::uint64_t> bits) noexcept
+{
+  return detail::filter_bits<false>(in, bits,
+                    [=](auto v) { return v <= decltype(v){} + x; },
+                    [=](T v) { return v <= x; });
+}
+
+/// Select elements equal to x. Compares raw storage; nothing is swapped but
+/// the constant.
+template<std::integral T, std::endian E>
+std::size_t filter_eq(std::span<const Int<T, E>> in, T x,
+                      std::span<std::uint64_t> bits) noexcept
+{
+  const T raw = Int<T, E>{x}.raw();
+  return detail::filter_bits<true>(in, bits,
+                    [=](auto v) { return v == decltype(v){} + raw; },
+                    [=](T v) { return v == raw; });
+}
+
+/// Select elements x with lo <= x <= hi.
+template<std::integral T, std::endian E>
+std::size_t filter_between(std::span<const Int<T, E>> in, T lo, T hi,
+                           std::span<std::uint64_t> bits) noexcept
+{
+  return detail::filter_bits<false>(in, bits,
+                    [=](auto v) {
+                      using V = decltype(v);
+                      return (v >= V{} + lo) & (v <= V{} + hi);
+                    },
+                    [=](T v) { return lo <= v && v <= hi; });
+}
+/// @}
+
+/// Write the position of each set bit of a selection bitmask to out, in
+/// increasing order. out must have room for every set bit.
+/// @return the number of positions written
+inline std::size_t select_indices(std::span<const std::uint64_t> bits,
+                                  std::span<std::uint32_t> out) noexcept
+{
+  std::size_t count = 0;
+  for (std::size_t w = 0; w != bits.size(); ++w) {
+    for (auto x = bits[w]; x != 0; x &= x - 1) {
+      auto bit = static_cast<std::size_t>(std::countr_zero(x));
+      out[count++] = static_cast<std::uint32_t>(w * 64 + bit);
+    }
+  }
+  return count;
+} // select_indices
+
+/// Copy the elements of in selected by a bitmask to the front of out, in order,
+/// converting them to byte order E2. Bits past in.size() are ignored.
+/// @param in   source elements
+/// @param bits selection bitmask of (in.size() + 63) / 64 words
+/// @param out  destination, room for every selected element
+/// @return the number of elements written
+template<std::integral T, std::endian E, std::endian E2>
+std::size_t compact(std::span<const Int<T, E>> in,
+                    std::span<const std::uint64_t> bits,
+                    std::span<Int<T, E2>> out) noexcept
+{
+  [[maybe_unused]] constexpr std::size_t S = sizeof(T);
+  [[maybe_unused]] const T* p = detail::raw_data(in);
+  [[maybe_unused]] T* q = detail::raw_data(out);
+  const auto n = in.size();
+  std::size_t k = 0;
+  std::size_t i = 0;
+  // Vector stores write whole registers past the last selected element, so
+  // they stop 64 elements short of the end of out.
+#if TJG_INT_SIMD && defined(__AVX512F__) && defined(__AVX512BW__)
+  if constexpr (detail::HasCompress512<S>) {
+    using V [[gnu::vector_size(64)]] = T;
+    constexpr std::size_t L = 64 / S;
+    for (; i + 64 <= n && k + 64 <= out.size(); i += 64) {
+      const auto w = bits[i / 64];
+      for (std::size_t j = 0; j != 64; j += L) {
+        const auto m = (w >> j) & detail::LowBits<L>;
+        if (m == 0)
+          continue;
+        V v;
+        std::memcpy(&v, p + i + j, sizeof(v));
+        auto x = reinterpret_cast<__m512i>(detail::vconvert<E, E2>(v));
+        _mm512_storeu_si512(q + k, detail::compress512<S>(x, m));
+        k += static_cast<std::size_t>(std::popcount(m));
+      }
+    }
+  }
+#endif
+#if TJG_INT_SIMD && defined(__AVX2__)
+  if constexpr (S >= 4) {
+    constexpr std::size_t L = 32 / S;
+    for (; i + 64 <= n && k + 64 <= out.size(); i += 64) {
+      const auto w = bits[i / 64];
+      for (std::size_t j = 0; j != 64; j += L) {
+        const auto m = (w >> j) & detail::LowBits<L>;
+        if (m == 0)
+          continue;
+        auto v = detail::vconvert<E, E2>(detail::vload(p + i + j));
+        auto x = detail::compress256(reinterpret_cast<__m256i>(v),
+                                     (S == 4) ? m : detail::double_bits(m));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(q + k), x);
+        k += static_cast<std::size_t>(std::popcount(m));
+      }
+    }
+  }
+#endif
+  for (; i < n; i += 64) {
+    auto w = bits[i / 64];
+    if (n - i < 64)
+      w &= (std::uint64_t{1} << (n - i)) - 1;
+    for (; w != 0; w &= w - 1) {
+      auto j = i + static_cast<std::size_t>(std::countr_zero(w));
+      out[k++] = Int<T, E2>{in[j].value()};
+    }
+  }
+  return k;
+} // compact
+
+} // tjg
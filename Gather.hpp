@@ -0,0 +1,157 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Indexed gather from fixed-endian Int tables.
+/// @details
+/// ::tjg::gather() looks up table[idx[i]] for every index of a
+/// std::span<const std::uint32_t> and writes the native values to out. 32- and
+/// 64-bit elements are fetched with AVX-512 or AVX2 gather instructions and
+/// byte-swapped in the same register; 8- and 16-bit elements, for which no
+/// gather exists, are fetched one at a time.
+///
+/// Lookups into a table much larger than the caches, such as a multi-GB
+/// memory-mapped file, are bound by memory latency, so gather() also
+/// prefetches the rows that will be needed a configurable number of indices
+/// ahead. The hardware prefetcher cannot do this, since the addresses are
+/// random.
+///
+/// Gather instructions take signed 32-bit indices; for tables of more than
+/// 2^31 elements the indices are zero-extended to 64 bits first.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <algorithm>  // std::min
+#include <bit>        // std::endian
+#include <cstdint>    // std::uint32_t
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// Default prefetch distance of gather(), in indices.
+inline constexpr std::size_t GatherAhead = 32;
+
+namespace detail {
+
+/// Prefetch the rows of p named by idx[first, first + count).
+template<typename T>
+[[gnu::always_inline]]
+inline void prefetch_rows([[maybe_unused]] const T* p,
+                          std::span<const std::uint32_t> idx,
+                          std::size_t first, std::size_t count) noexcept
+{
+#if defined(__GNUC__)
+  const auto last = std::min(idx.size(), first + count);
+  for (auto j = first; j < last; ++j)
+    __builtin_prefetch(p + idx[j]);
+#endif
+}
+
+#if TJG_INT_SIMD
+/// Store the lanes of a gathered register, in storage order E, as native T.
+template<std::endian E, typename T, typename X>
+[[gnu::always_inline]] inline void store_native(T* q, X x) noexcept {
+  using V [[gnu::vector_size(sizeof(X))]] = T;
+  vstore(q, vnative<E>(reinterpret_cast<V>(x)));
+}
+#endif
+
+#if TJG_INT_SIMD && defined(__AVX512F__)
+// GCC's unmasked AVX-512 gathers and widenings merge into an undefined
+// register, which trips -Wmaybe-uninitialized. The masked forms used here
+// take a zeroed source with every lane enabled; that costs one xor.
+
+/// Zero-extend the eight indices at ix to 64 bits.
+[[gnu::always_inline]]
+inline __m512i widen_index(const std::uint32_t* ix) noexcept {
+  return _mm512_maskz_cvtepu32_epi64(0xff,
+           _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ix)));
+}
+#endif
+
+} // detail
+
+/// Write the native value of table[idx[i]] to out[i] for every i. Every index
+/// must be less than table.size(), and out must have room for idx.size()
+/// elements.
+/// @param ahead prefetch distance in indices; 0 disables prefetching
+template<std::integral T, std::endian E>
+void gather(std::span<const Int<T, E>> table,
+            std::span<const std::uint32_t> idx, std::span<T> out,
+            std::size_t ahead = GatherAhead) noexcept
+{
+  [[maybe_unused]] constexpr std::size_t S = sizeof(T);
+  [[maybe_unused]] const bool wide = (table.size() > (std::size_t{1} << 31));
+  const T* p = detail::raw_data(table);
+  [[maybe_unused]] const std::uint32_t* ix = idx.data();
+  [[maybe_unused]] T* q = out.data();
+  const auto n = idx.size();
+  std::size_t i = 0;
+#if TJG_INT_SIMD && defined(__AVX512F__)
+  if constexpr (S == 8) {
+    for (; i + 8 <= n; i += 8) {
+      if (ahead)
+        detail::prefetch_rows(p, idx, i + ahead, 8);
+      auto g = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), 0xff,
+                                           detail::widen_index(ix + i), p, 8);
+      detail::store_native<E>(q + i, g);
+    }
+  }
+  if constexpr (S == 4) {
+    if (!wide) {
+      for (; i + 16 <= n; i += 16) {
+        if (ahead)
+          detail::prefetch_rows(p, idx, i + ahead, 16);
+        auto g = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xffff,
+                                             _mm512_loadu_si512(ix + i), p, 4);
+        detail::store_native<E>(q + i, g);
+      }
+    }
+    for (; i + 8 <= n; i += 8) {
+      if (ahead)
+        detail::prefetch_rows(p, idx, i + ahead, 8);
+      auto g = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), 0xff,
+                                           detail::widen_index(ix + i), p, 4);
+      detail::store_native<E>(q + i, g);
+    }
+  }
+#elif TJG_INT_SIMD && defined(__AVX2__)
+  if constexpr (S == 8) {
+    const auto* base = reinterpret_cast<const long long*>(p);
+    for (; i + 4 <= n; i += 4) {
+      if (ahead)
+        detail::prefetch_rows(p, idx, i + ahead, 4);
+      auto j = _mm256_cvtepu32_epi64(
+                  _mm_loadu_si128(reinterpret_cast<const __m128i*>(ix + i)));
+      detail::store_native<E>(q + i, _mm256_i64gather_epi64(base, j, 8));
+    }
+  }
+  if constexpr (S == 4) {
+    const auto* base = reinterpret_cast<const int*>(p);
+    if (!wide) {
+      for (; i + 8 <= n; i += 8) {
+        if (ahead)
+          detail::prefetch_rows(p, idx, i + ahead, 8);
+        auto j = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ix + i));
+        detail::store_native<E>(q + i, _mm256_i32gather_epi32(base, j, 4));
+      }
+    }
+    for (; i + 4 <= n; i += 4) {
+      if (ahead)
+        detail::prefetch_rows(p, idx, i + ahead, 4);
+      auto j = _mm256_cvtepu32_epi64(
+                  _mm_loadu_si128(reinterpret_cast<const __m128i*>(ix + i)));
+      detail::store_native<E>(q + i, _mm256_i64gather_epi32(base, j, 4));
+    }
+  }
+#endif
+  for (; i != n; ++i) {
+    if (ahead)
+      detail::prefetch_rows(p, idx, i + ahead, 1);
+    out[i] = table[idx[i]].value();
+  }
+} // gather
+
+} // tjg
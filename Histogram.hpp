@@ -0,0 +1,143 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Histograms of 8- and 16-bit fixed-endian Int columns.
+/// @details
+/// ::tjg::histogram() counts how often each value occurs in a
+/// std::span<const Int<T, E>> with sizeof(T) <= 2, such as message types or
+/// port numbers. Elements are counted by raw storage, so nothing is swapped
+/// per element; the bins are remapped to native values once at the end.
+/// Counting goes round-robin into four 32-bit sub-histograms, so that runs of
+/// equal values do not stall on a store-to-load dependency through one
+/// counter, and the sub-histograms are folded into the 64-bit result every
+/// 2^32 - 1 elements.
+///
+/// ::tjg::parallel_histogram() gives each thread a private histogram of its
+/// chunk of the input, then merges them with each thread summing its own range
+/// of bins.
+
+#pragma once
+#include "Int.hpp"
+
+#include <span>         // std::span
+#include <algorithm>    // std::min, std::max, std::ranges::fill
+#include <limits>       // std::numeric_limits
+#include <thread>       // std::jthread, std::thread::hardware_concurrency
+#include <type_traits>  // std::make_unsigned_t
+#include <vector>       // std::vector
+#include <bit>          // std::endian, std::byteswap
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <cstddef>      // std::size_t
+
+namespace tjg {
+
+/// Number of bins in a histogram of T: one per bit pattern.
+template<std::integral T>
+requires (sizeof(T) <= 2)
+inline constexpr std::size_t HistogramBins = std::size_t{1} << (8 * sizeof(T));
+
+/// Smallest input for which parallel_histogram() starts threads by default.
+inline constexpr std::size_t ParallelHistogramMin = std::size_t{1} << 24;
+
+namespace detail {
+
+/// Add the histogram of in to counts.
+template<std::integral T, std::endian E>
+void histogram_add(std::span<const Int<T, E>> in,
+                   std::span<std::uint64_t> counts)
+{
+  using R = std::make_unsigned_t<T>;
+  constexpr std::size_t Bins = HistogramBins<T>;
+  constexpr std::size_t Ways = 4;
+  constexpr std::size_t Batch = std::numeric_limits<std::uint32_t>::max();
+  const R* p = reinterpret_cast<const R*>(in.data());
+  const auto n = in.size();
+  std::vector<std::uint32_t> sub(Ways * Bins);
+  std::uint32_t* h = sub.data();
+  for (std::size_t b = 0; b < n; b += Batch) {
+    const std::size_t end = std::min(n, b + Batch);
+    std::size_t i = b;
+    for (; i + Ways <= end; i += Ways) {
+      ++h[0 * Bins + p[i + 0]];
+      ++h[1 * Bins + p[i + 1]];
+      ++h[2 * Bins + p[i + 2]];
+      ++h[3 * Bins + p[i + 3]];
+    }
+    for (; i != end; ++i)
+      ++h[p[i]];
+    for (std::size_t k = 0; k != Bins; ++k) {
+      auto r = static_cast<R>(k);
+      if constexpr (E != std::endian::native)
+        r = std::byteswap(r);
+      counts[r] += std::uint64_t{h[k]} + h[Bins + k] + h[2 * Bins + k]
+                 + h[3 * Bins + k];
+    }
+    std::ranges::fill(sub, 0u);
+  }
+} // histogram_add
+
+} // detail
+
+/// @name Histograms
+/// Add the number of elements of in with each value to counts, which must
+/// have HistogramBins<T> elements; value x is counted in
+/// counts[static_cast<std::make_unsigned_t<T>>(x)]. counts is not cleared
+/// first, so a stream can be histogrammed a piece at a time.
+/// @{
+template<std::integral T, std::endian E>
+requires (sizeof(T) <= 2)
+void histogram(std::span<const Int<T, E>> in, std::span<std::uint64_t> counts)
+  { detail::histogram_add(in, counts); }
+
+/// histogram() split over threads; 0 threads uses one per core for inputs of
+/// at least ParallelHistogramMin elements and one thread otherwise.
+template<std::integral T, std::endian E>
+requires (sizeof(T) <= 2)
+void parallel_histogram(std::span<const Int<T, E>> in,
+                        std::span<std::uint64_t> counts, unsigned threads = 0)
+{
+  constexpr std::size_t Bins = HistogramBins<T>;
+  const auto n = in.size();
+  if (threads == 0) {
+    threads = (n >= ParallelHistogramMin)
+            ? std::thread::hardware_concurrency() : 1;
+  }
+  threads = std::max(threads, 1u);
+  const std::size_t chunk = (n + threads - 1) / threads;
+  const std::size_t parts = (chunk == 0) ? 0 : (n + chunk - 1) / chunk;
+  if (parts <= 1) {
+    detail::histogram_add(in, counts);
+    return;
+  }
+  std::vector<std::uint64_t> local(parts * Bins);
+  auto table = [&](std::size_t t)
+    { return std::span{local}.subspan(t * Bins, Bins); };
+  {
+    std::vector<std::jthread> pool;
+    pool.reserve(parts);
+    for (std::size_t t = 0; t != parts; ++t) {
+      pool.emplace_back([&, t] {
+        auto first = t * chunk;
+        detail::histogram_add(in.subspan(first, std::min(chunk, n - first)),
+                              table(t));
+      });
+    }
+  }
+  // Merge: thread t sums bins [t * step, (t + 1) * step) over all tables.
+  const std::size_t step = (Bins + parts - 1) / parts;
+  std::vector<std::jthread> pool;
+  pool.reserve(parts);
+  for (std::size_t t = 0; t != parts && t * step < Bins; ++t) {
+    pool.emplace_back([&, t] {
+      auto last = std::min(Bins, (t + 1) * step);
+      for (std::size_t s = 0; s != parts; ++s) {
+        auto h = table(s);
+        for (auto k = t * step; k != last; ++k)
+          counts[k] += h[k];
+      }
+    });
+  }
+} // parallel_histogram
+/// @}
+
+} // tjg
@@ -7,17 +7,19 @@
 /// Defines ::tjg::Int<T, E> which stores an integral value using a specified
 /// std::endian. It offers constexpr accessors for host- and storage-order views,
 /// constrained conversions via NonNarrowing, ordering, hashing, and explicit
-/// helpers like endian_cast and byteswap.
+/// helpers like endian_cast and byteswap, and consteval helpers that build
+/// constant tables and wire-format templates at compile time.
 
 #pragma once
 #include <concepts>   // std::integral
 #include <functional> // std::hash
 #include <type_traits>// std::is_trivially_copyable_t
 #include <compare>    // operator<=>
-#include <bit>        // std::endian, std::byteswap
+#include <bit>        // std::endian, std::byteswap, std::bit_cast
+#include <array>      // std::array
 #include <memory>     // std::addressof
 #include <utility>    // std::declval
-#include <cstddef>    // std::size_t
+#include <cstddef>    // std::size_t, std::byte
 
 namespace std {
 
@@ -322,6 +324,32 @@ template<std::integral T, std::endian E>
 constexpr Int<T, ~E> byteswap(Int<T, E> x) noexcept
   { return Int<T, ~E>{x}; }
 
+/// Convert a table of native values to Int<T, E> at compile time. A constexpr
+/// variable initialized this way, e.g.
+/// `constexpr auto Crc = to_int_array<std::endian::big>(CrcTable);`,
+/// is stored already swapped in read-only data; nothing runs at startup.
+/// @tparam E   byte order of the result
+/// @param a table of native values
+/// @return a.size() Int<T, E> holding the same values
+template<std::endian E, std::integral T, std::size_t N>
+consteval std::array<Int<T, E>, N> to_int_array(const std::array<T, N>& a)
+  noexcept
+{
+  std::array<Int<T, E>, N> r;
+  for (std::size_t i = 0; i != N; ++i)
+    r[i] = Int<T, E>{a[i]};
+  return r;
+}
+
+/// Object representation of a value, such as a message struct of Int fields,
+/// at compile time; for wire-format templates kept in read-only data. A type
+/// with padding bits does not compile, since their bytes have no value.
+/// @param x trivially copyable value without pointers or unions
+/// @return the sizeof(x) bytes of x
+template<typename S> requires std::is_trivially_copyable_v<S>
+consteval std::array<std::byte, sizeof(S)> to_bytes(const S& x) noexcept
+  { return std::bit_cast<std::array<std::byte, sizeof(S)>>(x); }
+
 /// Alias for big-endian signed Int with underlying type T.
 template<std::signed_integral   T=int>
 using BigInt    = Int<T, std::endian::big>;
@@ -355,6 +383,46 @@ using LilUint16  = LilUint<std::uint16_t>;
 using LilUint32  = LilUint<std::uint32_t>;
 using LilUint64  = LilUint<std::uint64_t>;
 
+namespace detail {
+
+// Not constexpr: calling it makes an out-of-range literal ill-formed.
+void int_literal_out_of_range();
+
+/// Int<T, E> literal, swapped at compile time and stored with Int::Raw.
+template<std::unsigned_integral T, std::endian E>
+consteval Int<T, E> int_literal(unsigned long long x) noexcept {
+  if (x > T(~T{0}))
+    int_literal_out_of_range();
+  const auto v = static_cast<T>(x);
+  return Int<T, E>::Raw((E == std::endian::native) ? v : std::byteswap(v));
+}
+
+} // detail
+
+/// User-defined literals for unsigned fixed-endian constants, e.g.
+/// `0x0800_be16` is a BigUint16 and `42_le32` a LilUint32. They are
+/// consteval, so every use is a constant, and a value that does not fit is a
+/// compile error. Bring them in with `using namespace tjg::literals;`.
+inline namespace literals {
+inline namespace int_literals {
+
+consteval BigUint16 operator""_be16(unsigned long long x) noexcept
+  { return detail::int_literal<std::uint16_t, std::endian::big>(x); }
+consteval BigUint32 operator""_be32(unsigned long long x) noexcept
+  { return detail::int_literal<std::uint32_t, std::endian::big>(x); }
+consteval BigUint64 operator""_be64(unsigned long long x) noexcept
+  { return detail::int_literal<std::uint64_t, std::endian::big>(x); }
+
+consteval LilUint16 operator""_le16(unsigned long long x) noexcept
+  { return detail::int_literal<std::uint16_t, std::endian::little>(x); }
+consteval LilUint32 operator""_le32(unsigned long long x) noexcept
+  { return detail::int_literal<std::uint32_t, std::endian::little>(x); }
+consteval LilUint64 operator""_le64(unsigned long long x) noexcept
+  { return detail::int_literal<std::uint64_t, std::endian::little>(x); }
+
+} // int_literals
+} // literals
+
 } // tjg
 
 namespace std {
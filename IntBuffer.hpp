@@ -0,0 +1,142 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Owning aligned buffer of fixed-endian Int that can change byte order
+/// in place.
+/// @details
+/// ::tjg::IntBuffer<T, E> owns a cache-line-aligned array of Int<T, E>, like a
+/// fixed-size std::vector. Its one trick is swap_endianness(), callable only on
+/// an rvalue: it byte-swaps every element in place, a vector at a time, and
+/// hands the same memory back as an IntBuffer<T, ~E> holding the same values.
+/// No second buffer is allocated, so a multi-gigabyte column changes byte
+/// order with no extra memory.
+///
+/// Int<T, E> and Int<T, ~E> are distinct types, so the memory must hold objects
+/// of the new type before it is used as one. Both are implicit-lifetime types
+/// with the same size and alignment; the new array's lifetime is started with
+/// std::start_lifetime_as_array where the library has it, and the pointer is
+/// laundered otherwise.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <memory>     // std::uninitialized_copy_n,
+                      // std::uninitialized_value_construct_n,
+                      // std::start_lifetime_as_array
+#include <new>        // std::align_val_t, std::launder
+#include <utility>    // std::exchange, std::swap
+#include <bit>        // std::endian, std::byteswap
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// Fixed-size, move-only, owning array of Int<T, E>, aligned to Alignment.
+template<std::integral T, std::endian E = std::endian::native>
+class IntBuffer {
+public:
+  using value_type = Int<T, E>;
+  using iterator = value_type*;
+  using const_iterator = const value_type*;
+  static constexpr std::endian Endian = E;
+  static constexpr std::size_t Alignment = 64;
+
+private:
+  template<std::integral, std::endian> friend class IntBuffer;
+
+  value_type* _data = nullptr;
+  std::size_t _size = 0;
+
+  static value_type* _allocate(std::size_t n) {
+    auto* p = ::operator new(n * sizeof(value_type),
+                             std::align_val_t{Alignment});
+    return static_cast<value_type*>(p);
+  }
+
+  // Adopt an array made by _allocate().
+  IntBuffer(value_type* p, std::size_t n) noexcept : _data{p}, _size{n} { }
+
+public:
+  /// @name Constructors
+  /// @{
+  IntBuffer() = default;
+
+  /// n zeros.
+  explicit IntBuffer(std::size_t n) : _data{_allocate(n)}, _size{n}
+    { std::uninitialized_value_construct_n(_data, n); }
+
+  /// A copy of s.
+  explicit IntBuffer(std::span<const value_type> s)
+    : _data{_allocate(s.size())}, _size{s.size()}
+    { std::uninitialized_copy_n(s.data(), _size, _data); }
+
+  IntBuffer(IntBuffer&& other) noexcept
+    : _data{std::exchange(other._data, nullptr)}
+    , _size{std::exchange(other._size, 0)}
+  { }
+
+  IntBuffer& operator=(IntBuffer&& other) noexcept {
+    IntBuffer{std::move(other)}.swap(*this);
+    return *this;
+  }
+
+  ~IntBuffer() {
+    if (_data)
+      ::operator delete(_data, std::align_val_t{Alignment});
+  }
+  /// @}
+
+  void swap(IntBuffer& other) noexcept {
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+  }
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] std::size_t size() const noexcept { return _size; }
+  [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+
+  [[nodiscard]]       value_type* data()       noexcept { return _data; }
+  [[nodiscard]] const value_type* data() const noexcept { return _data; }
+
+  [[nodiscard]] std::span<value_type> span() noexcept { return {_data, _size}; }
+  [[nodiscard]] std::span<const value_type> span() const noexcept
+    { return {_data, _size}; }
+
+  operator std::span<value_type>() noexcept { return span(); }
+  operator std::span<const value_type>() const noexcept { return span(); }
+
+  value_type& operator[](std::size_t i) noexcept { return _data[i]; }
+  const value_type& operator[](std::size_t i) const noexcept
+    { return _data[i]; }
+
+  iterator begin() noexcept { return _data; }
+  iterator end()   noexcept { return _data + _size; }
+  const_iterator begin() const noexcept { return _data; }
+  const_iterator end()   const noexcept { return _data + _size; }
+  /// @}
+
+  /// Byte-swap every element in place and return the same memory as a buffer
+  /// of the opposite byte order, holding the same values. Leaves *this empty.
+  [[nodiscard]] IntBuffer<T, ~E> swap_endianness() && noexcept {
+    using Other = Int<T, ~E>;
+#if TJG_INT_SIMD
+    auto vswap = [](auto v) { return detail::vbyteswap(v); };
+#else
+    auto vswap = [](auto v) { return v; }; // not called
+#endif
+    detail::transform<true, T>(span(), vswap,
+                               [](T x) { return std::byteswap(x); });
+    void* p = std::exchange(_data, nullptr);
+    const auto n = std::exchange(_size, 0);
+#if defined(__cpp_lib_start_lifetime_as)
+    auto* q = std::start_lifetime_as_array<Other>(p, n);
+#else
+    auto* q = std::launder(static_cast<Other*>(p));
+#endif
+    return IntBuffer<T, ~E>{q, n};
+  } // swap_endianness
+}; // IntBuffer
+
+} // tjg
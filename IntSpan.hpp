@@ -0,0 +1,445 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Bulk operations on spans of fixed-endian Int.
+/// @details
+/// Functions here take whole std::span<Int<T, E>> arguments so that swaps,
+/// compares and stores are done a vector at a time rather than per element.
+/// Int<T, E> is standard-layout with a single T member, so an Int and its raw
+/// storage are pointer-interconvertible and the kernels work on T directly.
+///
+/// Vector code uses GCC/Clang vector extensions, 32 bytes wide when AVX2 is
+/// enabled and 16 bytes otherwise; a byte reversal is a single constant
+/// shuffle (pshufb on x86). A few kernels use SSE2/AVX2 intrinsics directly.
+/// Define TJG_INT_NO_SIMD to force the portable scalar fallbacks, which give
+/// the same results.
+
+#pragma once
+#include "Int.hpp"
+
+#include <span>       // std::span
+#include <algorithm>  // std::ranges::fill, std::min, std::max, std::clamp
+#include <limits>     // std::numeric_limits
+#include <type_traits> // std::make_unsigned_t, std::common_type_t
+#include <utility>    // std::index_sequence
+#include <bit>        // std::endian, std::countr_one
+#include <cstring>    // std::memcpy
+#include <cstdint>    // std::uint32_t
+#include <cstddef>    // std::size_t
+
+#if !defined(TJG_INT_NO_SIMD) && defined(__GNUC__)
+#define TJG_INT_SIMD 1
+#else
+#define TJG_INT_SIMD 0
+#endif
+
+#if TJG_INT_SIMD && defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace tjg {
+
+namespace detail {
+
+#if TJG_INT_SIMD
+#if defined(__AVX2__)
+inline constexpr std::size_t VecBytes = 32;
+#else
+inline constexpr std::size_t VecBytes = 16;
+#endif
+
+/// Native vector of T.
+template<typename T>
+using Vec [[gnu::vector_size(VecBytes)]] = T;
+
+/// Number of T lanes in a Vec<T>.
+template<typename T>
+inline constexpr std::size_t Lanes = VecBytes / sizeof(T);
+
+template<typename T>
+[[gnu::always_inline]] inline Vec<T> vload(const T* p) noexcept
+  { Vec<T> v; std::memcpy(&v, p, sizeof(v)); return v; }
+
+template<typename T, typename V>
+[[gnu::always_inline]] inline void vstore(T* p, V v) noexcept
+  { std::memcpy(p, &v, sizeof(v)); }
+
+template<typename T>
+[[gnu::always_inline]] inline Vec<T> vsplat(T x) noexcept
+  { return Vec<T>{} + x; }
+
+/// Vector of N bytes.
+template<std::size_t N>
+using Bytes [[gnu::vector_size(N)]] = unsigned char;
+
+template<typename V, std::size_t... I>
+[[gnu::always_inline]]
+inline V vbyteswap(V v, std::index_sequence<I...>) noexcept {
+  constexpr std::size_t S = sizeof(v[0]);
+  auto b = reinterpret_cast<Bytes<sizeof(V)>>(v);
+  return reinterpret_cast<V>(__builtin_shufflevector(b, b, (I ^ (S - 1))...));
+}
+
+/// Reverse the bytes of every lane of a vector of any width.
+template<typename V>
+[[gnu::always_inline]] inline V vbyteswap(V v) noexcept {
+  if constexpr (sizeof(v[0]) == 1)
+    return v;
+  else
+    return vbyteswap(v, std::make_index_sequence<sizeof(V)>{});
+}
+
+/// Convert lanes between storage order E and host order (an involution).
+template<std::endian E, typename V>
+[[gnu::always_inline]] inline V vnative(V v) noexcept {
+  if constexpr (E == std::endian::native)
+    return v;
+  else
+    return vbyteswap(v);
+}
+
+/// Convert lanes from storage order From to storage order To.
+template<std::endian From, std::endian To, typename V>
+[[gnu::always_inline]] inline V vconvert(V v) noexcept {
+  if constexpr (From == To)
+    return v;
+  else
+    return vbyteswap(v);
+}
+
+/// Keep the odd bits of x, packed into the low half.
+constexpr std::uint32_t odd_bits(std::uint32_t x) noexcept {
+  x = (x >> 1) & 0x55555555u;
+  x = (x | (x >> 1)) & 0x33333333u;
+  x = (x | (x >> 2)) & 0x0f0f0f0fu;
+  x = (x | (x >> 4)) & 0x00ff00ffu;
+  return (x | (x >> 8)) & 0x0000ffffu;
+}
+
+/// Collect one bit per lane of a comparison result (lanes all ones or all
+/// zeros); bit k is set when lane k is.
+template<typename V>
+[[gnu::always_inline]] inline std::uint32_t vmovemask(V m) noexcept {
+  constexpr std::size_t S = sizeof(m[0]);
+#if defined(__AVX2__)
+  auto x = reinterpret_cast<__m256i>(m);
+  if constexpr (S == 1)
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(x));
+  if constexpr (S == 2)
+    return odd_bits(static_cast<std::uint32_t>(_mm256_movemask_epi8(x)));
+  if constexpr (S == 4)
+    return static_cast<std::uint32_t>(
+                        _mm256_movemask_ps(_mm256_castsi256_ps(x)));
+  if constexpr (S == 8)
+    return static_cast<std::uint32_t>(
+                        _mm256_movemask_pd(_mm256_castsi256_pd(x)));
+#elif defined(__SSE2__)
+  auto x = reinterpret_cast<__m128i>(m);
+  if constexpr (S == 1)
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(x));
+  if constexpr (S == 2)
+    return odd_bits(static_cast<std::uint32_t>(_mm_movemask_epi8(x)));
+  if constexpr (S == 4)
+    return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(x)));
+  if constexpr (S == 8)
+    return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(x)));
+#else
+  std::uint32_t bits = 0;
+  for (std::size_t k = 0; k != VecBytes / S; ++k)
+    bits |= std::uint32_t{m[k] != 0} << k;
+  return bits;
+#endif
+} // vmovemask
+#endif
+
+/// Raw storage of the elements of s.
+template<std::integral T, std::endian E>
+const T* raw_data(std::span<const Int<T, E>> s) noexcept
+  { return reinterpret_cast<const T*>(s.data()); }
+
+template<std::integral T, std::endian E>
+T* raw_data(std::span<Int<T, E>> s) noexcept
+  { return reinterpret_cast<T*>(s.data()); }
+
+#if TJG_INT_SIMD && defined(__AVX2__)
+/// Broadcast a raw element to every lane.
+template<std::integral T>
+inline __m256i splat256(T x) noexcept {
+  if constexpr (sizeof(T) == 1) return _mm256_set1_epi8 (static_cast<char>(x));
+  if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(static_cast<short>(x));
+  if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(static_cast<int>(x));
+  if constexpr (sizeof(T) == 8)
+    return _mm256_set1_epi64x(static_cast<long long>(x));
+}
+#endif
+
+#if TJG_INT_SIMD && defined(__SSE2__)
+template<std::integral T>
+inline __m128i splat128(T x) noexcept {
+  if constexpr (sizeof(T) == 1) return _mm_set1_epi8 (static_cast<char>(x));
+  if constexpr (sizeof(T) == 2) return _mm_set1_epi16(static_cast<short>(x));
+  if constexpr (sizeof(T) == 4) return _mm_set1_epi32(static_cast<int>(x));
+  if constexpr (sizeof(T) == 8)
+    return _mm_set1_epi64x(static_cast<long long>(x));
+}
+#endif
+
+/// Replace every element of s by an operation on it, applied to lanes of W (T
+/// or its unsigned twin). vop is applied to whole vectors and sop to single
+/// elements; both see native values, or raw storage if Raw.
+template<bool Raw, typename W, std::integral T, std::endian E,
+         typename VOp, typename SOp>
+void transform(std::span<Int<T, E>> s, [[maybe_unused]] VOp vop, SOp sop)
+  noexcept
+{
+  static_assert(sizeof(W) == sizeof(T));
+  W* p = reinterpret_cast<W*>(s.data());
+  const auto n = s.size();
+  std::size_t i = 0;
+#if TJG_INT_SIMD
+  constexpr auto L = Lanes<W>;
+  for (; i + L <= n; i += L) {
+    auto v = vload(p + i);
+    if constexpr (Raw)
+      v = vop(v);
+    else
+      v = vnative<E>(vop(vnative<E>(v)));
+    vstore(p + i, v);
+  }
+#endif
+  for (; i != n; ++i) {
+    if constexpr (Raw)
+      p[i] = sop(p[i]);
+    else
+      p[i] = Int<W, E>{sop(Int<W, E>::Raw(p[i]).value())}.raw();
+  }
+} // transform
+
+/// Copy n raw elements from src to dst, converting between byte order E and
+/// native order (either way: the conversion is an involution).
+template<std::endian E, std::integral T>
+void copy_native(const T* src, T* dst, std::size_t n) noexcept {
+  std::size_t i = 0;
+#if TJG_INT_SIMD
+  constexpr auto L = Lanes<T>;
+  for (; i + L <= n; i += L)
+    vstore(dst + i, vnative<E>(vload(src + i)));
+#endif
+  for (; i != n; ++i)
+    dst[i] = Int<T, E>::Raw(src[i]).value();
+} // copy_native
+
+} // detail
+
+/// Set every element of s to value. The value is swapped once; the loop
+/// stores raw storage only.
+template<std::integral T, std::endian E>
+constexpr void fill(std::span<Int<T, E>> s, T value) noexcept
+  { std::ranges::fill(s, Int<T, E>{value}); }
+
+/// Return the index of the first element of s whose storage differs from
+/// that of value, or s.size() if there is none. Compares raw storage, so no
+/// element is swapped; useful for finding the end of a run.
+template<std::integral T, std::endian E>
+std::size_t find_not(std::span<const Int<T, E>> s, Int<T, E> value) noexcept {
+  const T* p = detail::raw_data(s);
+  const T  v = value.raw();
+  const auto n = s.size();
+  std::size_t i = 0;
+#if TJG_INT_SIMD && defined(__AVX2__)
+  {
+    constexpr std::size_t Lanes = 32 / sizeof(T);
+    const auto pat = detail::splat256(v);
+    for (; i + Lanes <= n; i += Lanes) {
+      auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+      auto eq = static_cast<unsigned>(
+                      _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, pat)));
+      if (eq != 0xffffffffu)
+        return i + static_cast<std::size_t>(std::countr_one(eq)) / sizeof(T);
+    }
+  }
+#endif
+#if TJG_INT_SIMD && defined(__SSE2__)
+  {
+    constexpr std::size_t Lanes = 16 / sizeof(T);
+    const auto pat = detail::splat128(v);
+    for (; i + Lanes <= n; i += Lanes) {
+      auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+      auto eq = static_cast<unsigned>(
+                      _mm_movemask_epi8(_mm_cmpeq_epi8(x, pat)));
+      if (eq != 0xffffu)
+        return i + static_cast<std::size_t>(std::countr_one(eq)) / sizeof(T);
+    }
+  }
+#endif
+  for (; i != n; ++i) {
+    if (p[i] != v)
+      return i;
+  }
+  return n;
+} // find_not
+
+/// Smallest and largest value of a span.
+template<std::integral T>
+struct MinMax {
+  T min;
+  T max;
+}; // MinMax
+
+/// Return the numeric minimum and maximum of s. For an empty span, min is the
+/// largest T and max is the smallest, so the result is an empty interval.
+template<std::integral T, std::endian E>
+MinMax<T> min_max(std::span<const Int<T, E>> s) noexcept {
+  auto r = MinMax<T>{std::numeric_limits<T>::max(),
+                     std::numeric_limits<T>::min()};
+  const auto n = s.size();
+  std::size_t i = 0;
+#if TJG_INT_SIMD
+  constexpr auto L = detail::Lanes<T>;
+  const T* p = detail::raw_data(s);
+  if (n >= L) {
+    auto lo = detail::vnative<E>(detail::vload(p));
+    auto hi = lo;
+    for (i = L; i + L <= n; i += L) {
+      auto v = detail::vnative<E>(detail::vload(p + i));
+      lo = (v < lo) ? v : lo;
+      hi = (v > hi) ? v : hi;
+    }
+    for (std::size_t k = 0; k != L; ++k) {
+      r.min = std::min<T>(r.min, lo[k]);
+      r.max = std::max<T>(r.max, hi[k]);
+    }
+  }
+#endif
+  for (; i != n; ++i) {
+    T x = s[i].value();
+    r.min = std::min(r.min, x);
+    r.max = std::max(r.max, x);
+  }
+  return r;
+} // min_max
+
+/// @name In-place arithmetic
+/// Update every element of s as the matching Int compound assignment would,
+/// a vector at a time: load, swap to native, operate, swap back, store.
+/// Arithmetic wraps modulo 2^bits(T).
+/// @{
+/// x += k.
+template<std::integral T, std::endian E>
+void add(std::span<Int<T, E>> s, T k) noexcept {
+  using W = std::make_unsigned_t<T>;
+  const auto w = static_cast<W>(k);
+  detail::transform<false, W>(s, [=](auto v) { return v + w; },
+                              [=](W x) { return static_cast<W>(x + w); });
+}
+
+/// x -= k.
+template<std::integral T, std::endian E>
+void sub(std::span<Int<T, E>> s, T k) noexcept {
+  using W = std::make_unsigned_t<T>;
+  const auto w = static_cast<W>(k);
+  detail::transform<false, W>(s, [=](auto v) { return v - w; },
+                              [=](W x) { return static_cast<W>(x - w); });
+}
+
+/// x *= k.
+template<std::integral T, std::endian E>
+void mul(std::span<Int<T, E>> s, T k) noexcept {
+  using W = std::make_unsigned_t<T>;
+  const auto w = static_cast<W>(k);
+  // Multiply at least as unsigned: W operands would promote to int.
+  using M = std::common_type_t<W, unsigned>;
+  detail::transform<false, W>(s, [=](auto v) { return v * w; },
+                              [=](W x) { return static_cast<W>(M{x} * w); });
+}
+
+/// x <<= k, for k < bits(T).
+template<std::integral T, std::endian E>
+void shift_left(std::span<Int<T, E>> s, unsigned k) noexcept {
+  using W = std::make_unsigned_t<T>;
+  const auto w = static_cast<W>(k);
+  detail::transform<false, W>(s,
+                    [=](auto v) { return v << (decltype(v){} + w); },
+                    [=](W x) { return static_cast<W>(x << k); });
+}
+
+/// x >>= k, for k < bits(T); arithmetic for signed T.
+template<std::integral T, std::endian E>
+void shift_right(std::span<Int<T, E>> s, unsigned k) noexcept {
+  const auto w = static_cast<T>(k);
+  detail::transform<false, T>(s,
+                    [=](auto v) { return v >> (decltype(v){} + w); },
+                    [=](T x) { return static_cast<T>(x >> k); });
+}
+
+/// x = std::clamp(x, lo, hi), for lo <= hi.
+template<std::integral T, std::endian E>
+void clamp(std::span<Int<T, E>> s, T lo, T hi) noexcept {
+  detail::transform<false, T>(s,
+                    [=](auto v) {
+                      using V = decltype(v);
+                      v = (v < V{} + lo) ? V{} + lo : v;
+                      return (v > V{} + hi) ? V{} + hi : v;
+                    },
+                    [=](T x) { return std::clamp(x, lo, hi); });
+}
+/// @}
+
+/// @name In-place bitwise operations
+/// The mask is swapped once, at compile time when it is a constant, and the
+/// loop works on raw storage with no shuffles at all.
+/// @{
+/// x &= k.
+template<std::integral T, std::endian E>
+void bit_and(std::span<Int<T, E>> s, T k) noexcept {
+  const T raw = Int<T, E>{k}.raw();
+  detail::transform<true, T>(s, [=](auto v) { return v & raw; },
+                             [=](T x) { return static_cast<T>(x & raw); });
+}
+
+/// x |= k.
+template<std::integral T, std::endian E>
+void bit_or(std::span<Int<T, E>> s, T k) noexcept {
+  const T raw = Int<T, E>{k}.raw();
+  detail::transform<true, T>(s, [=](auto v) { return v | raw; },
+                             [=](T x) { return static_cast<T>(x | raw); });
+}
+
+/// x ^= k.
+template<std::integral T, std::endian E>
+void bit_xor(std::span<Int<T, E>> s, T k) noexcept {
+  const T raw = Int<T, E>{k}.raw();
+  detail::transform<true, T>(s, [=](auto v) { return v ^ raw; },
+                             [=](T x) { return static_cast<T>(x ^ raw); });
+}
+/// @}
+
+/// Bytes of native scratch per block of transform_native(), sized to stay in
+/// L1 data cache alongside the block being rewritten.
+inline constexpr std::size_t NativeBlockBytes = 16 * 1024;
+
+/// Run arbitrary read-modify-write code over s in native order: each block of
+/// NativeBlockBytes is decoded into scratch a vector at a time, passed to
+/// fn(std::span<T>), and encoded back in place. fn is called on consecutive
+/// blocks in order, and may be called once for all of s when E is native.
+/// Two bulk passes per block replace a swap-compute-swap per element, and fn
+/// sees a plain array of T that the compiler can vectorize.
+template<std::integral T, std::endian E, typename Fn>
+void transform_native(std::span<Int<T, E>> s, Fn fn) {
+  T* p = detail::raw_data(s);
+  const auto n = s.size();
+  if constexpr (E == std::endian::native) {
+    fn(std::span<T>{p, n});
+  } else {
+    constexpr std::size_t Block = NativeBlockBytes / sizeof(T);
+    alignas(64) T buf[Block];
+    for (std::size_t i = 0; i < n; i += Block) {
+      const auto m = std::min(Block, n - i);
+      detail::copy_native<E>(p + i, buf, m);
+      fn(std::span<T>{buf, m});
+      detail::copy_native<E>(buf, p + i, m);
+    }
+  }
+} // transform_native
+
+} // tjg
@@ -0,0 +1,148 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief K-way merge of sorted fixed-endian Int runs.
+/// @details
+/// Defines ::tjg::KWayMerge<T, E>, which merges any number of sorted
+/// std::span<const Int<T, E>> runs, such as the memory-mapped runs of an
+/// external sort, with a loser tree: each output element costs one leaf-to-root
+/// pass of log2(k) comparisons, one per level, against the stored loser of
+/// each match. Keys are decoded to native order a block at a time per run, so
+/// the tree compares plain integers, and output is written a batch at a time
+/// in either byte order. ::tjg::merge() merges everything in one call.
+
+#pragma once
+#include "Int.hpp"
+
+#include <span>       // std::span
+#include <vector>     // std::vector
+#include <algorithm>  // std::min, std::max
+#include <utility>    // std::swap
+#include <bit>        // std::endian, std::bit_ceil
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// Merge of sorted runs, read out in batches. Equal keys come out in run
+/// order, so the merge is stable. The runs must outlive the merge.
+template<std::integral T, std::endian E = std::endian::native>
+class KWayMerge {
+public:
+  using value_type = T;
+  using Value = Int<T, E>;
+  static constexpr std::endian Endian = E;
+
+  /// Keys decoded from a run at a time.
+  static constexpr std::size_t Block = 256;
+
+private:
+  std::vector<std::span<const Value>> _runs;
+  std::vector<std::size_t> _next;  // next element of each run to decode
+  std::vector<T> _buf;             // Block decoded keys per run
+  std::vector<std::size_t> _head;  // position of each run's key in its block
+  std::vector<std::size_t> _end;   // keys decoded into each block
+  std::vector<std::size_t> _loser; // _loser[0] is the winner
+  std::size_t _leaves = 0;
+  std::size_t _left = 0;
+
+  bool _live(std::size_t r) const noexcept { return _head[r] != _end[r]; }
+
+  T _key(std::size_t r) const noexcept { return _buf[r * Block + _head[r]]; }
+
+  // True if run a's key goes out before run b's.
+  bool _before(std::size_t a, std::size_t b) const noexcept {
+    if (!_live(a))
+      return false;
+    if (!_live(b))
+      return true;
+    T x = _key(a);
+    T y = _key(b);
+    return x < y || (x == y && a < b);
+  }
+
+  void _refill(std::size_t r) noexcept {
+    auto run = _runs[r];
+    auto n = std::min(Block, run.size() - _next[r]);
+    T* buf = _buf.data() + r * Block;
+    for (std::size_t k = 0; k != n; ++k)
+      buf[k] = run[_next[r] + k].value();
+    _next[r] += n;
+    _head[r] = 0;
+    _end[r] = n;
+  } // _refill
+
+  // Winner of the subtree rooted at node; records losers on the way.
+  std::size_t _play(std::size_t node) noexcept {
+    if (node >= _leaves)
+      return node - _leaves;
+    auto a = _play(2 * node);
+    auto b = _play(2 * node + 1);
+    if (_before(b, a))
+      std::swap(a, b);
+    _loser[node] = b;
+    return a;
+  } // _play
+
+public:
+  /// @name Constructors
+  /// @{
+  KWayMerge() = default;
+
+  /// Start merging runs, each sorted in increasing order.
+  explicit KWayMerge(std::span<const std::span<const Value>> runs)
+    : _runs(runs.begin(), runs.end())
+    , _leaves{std::bit_ceil(std::max<std::size_t>(runs.size(), 1))}
+  {
+    _runs.resize(_leaves);
+    _next.assign(_leaves, 0);
+    _buf.resize(_leaves * Block);
+    _head.assign(_leaves, 0);
+    _end.assign(_leaves, 0);
+    _loser.resize(_leaves);
+    for (std::size_t r = 0; r != _leaves; ++r) {
+      _left += _runs[r].size();
+      _refill(r);
+    }
+    _loser[0] = _play(1);
+  }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  /// Number of elements not yet read.
+  [[nodiscard]] std::size_t size() const noexcept { return _left; }
+  [[nodiscard]] bool empty() const noexcept { return _left == 0; }
+  /// @}
+
+  /// Write the next min(out.size(), size()) elements of the merge to out.
+  /// @return the number of elements written
+  template<std::endian E2>
+  std::size_t read(std::span<Int<T, E2>> out) noexcept {
+    const auto n = std::min(out.size(), _left);
+    if (n == 0)
+      return 0;
+    auto w = _loser[0];
+    for (std::size_t k = 0; k != n; ++k) {
+      out[k] = Int<T, E2>{_key(w)};
+      if (++_head[w] == _end[w] && _next[w] != _runs[w].size())
+        _refill(w);
+      for (auto node = (w + _leaves) / 2; node != 0; node /= 2) {
+        if (_before(_loser[node], w))
+          std::swap(_loser[node], w);
+      }
+    }
+    _loser[0] = w;
+    _left -= n;
+    return n;
+  } // read
+}; // KWayMerge
+
+/// Merge sorted runs into out, which must have room for all their elements,
+/// in any byte order.
+/// @return the number of elements written
+template<std::integral T, std::endian E, std::endian E2>
+std::size_t merge(std::span<const std::span<const Int<T, E>>> runs,
+                  std::span<Int<T, E2>> out)
+  { return KWayMerge<T, E>{runs}.read(out); }
+
+} // tjg
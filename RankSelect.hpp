@@ -0,0 +1,305 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Rank/select succinct bitvector stored in fixed-endian words.
+/// @details
+/// Defines ::tjg::RankSelect<E>, a read-only view over a rank9-style image of
+/// Int<std::uint64_t, E> words. Each 512-bit block interleaves its counts with
+/// its data: one absolute count, one word of seven packed 9-bit relative
+/// counts, then eight data words. After the blocks, select samples name the
+/// block holding every 512th one and every 512th zero, so select searches
+/// only the few blocks between two samples. Because the image is made of
+/// fixed-endian words, a file written on one host can be mapped and queried
+/// on any host with no load step.
+
+#pragma once
+#include "Int.hpp"
+
+#include <span>       // std::span
+#include <vector>     // std::vector
+#include <algorithm>  // std::min, std::max, std::fill
+#include <utility>    // std::pair
+#include <bit>        // std::endian, std::popcount, std::countr_zero
+#include <cstdint>    // std::uint64_t
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::invalid_argument
+
+#if defined(__BMI2__)
+#include <immintrin.h> // _pdep_u64
+#endif
+
+namespace tjg {
+
+/// Return the position of the set bit of rank r (zero-based) in x, or 64 if x
+/// has r or fewer set bits. Uses pdep when BMI2 is available.
+constexpr unsigned select64(std::uint64_t x, unsigned r) noexcept {
+  if !consteval {
+#if defined(__BMI2__)
+    if (r >= 64)
+      return 64;
+    return static_cast<unsigned>(
+                    std::countr_zero(_pdep_u64(std::uint64_t{1} << r, x)));
+#endif
+  }
+  unsigned shift = 0;
+  for (;;) {
+    if (shift == 64)
+      return 64;
+    auto n = static_cast<unsigned>(std::popcount((x >> shift) & 0xff));
+    if (r < n)
+      break;
+    r -= n;
+    shift += 8;
+  }
+  x >>= shift;
+  for (; r != 0; --r)
+    x &= x - 1;
+  return shift + static_cast<unsigned>(std::countr_zero(x));
+} // select64
+
+/// Read-only rank/select view over a fixed-endian rank9 image.
+///
+/// Image layout, all words Int<std::uint64_t, E>:
+/// - word 0: number of bits
+/// - word 1: number of set bits
+/// - then one 10-word block per 512 bits: absolute count of ones before the
+///   block, seven 9-bit counts of ones before data words 1..7, and eight data
+///   words (bit i of the vector is bit i%64 of data word i/64)
+/// - then ceil(ones/512) select1 samples, the block holding the one of rank
+///   512k for each k, and ceil(zeros/512) select0 samples, the same for zeros
+/// - then zero padding up to image_size().
+///
+/// select1() and select0() binary-search only the blocks between two samples,
+/// so they take constant time when ones and zeros are both dense, as in the
+/// high bits of EliasFano, and O(log n) at worst.
+template<std::endian E = std::endian::native>
+class RankSelect {
+public:
+  using Word = Int<std::uint64_t, E>;
+  static constexpr std::endian Endian = E;
+
+  static constexpr std::size_t WordBits    = 64;
+  static constexpr std::size_t BlockWords  = 8;
+  static constexpr std::size_t BlockBits   = BlockWords * WordBits;
+  static constexpr std::size_t BlockStride = 2 + BlockWords;
+  static constexpr std::size_t HeaderWords = 2;
+  static constexpr std::size_t SampleRate  = 512;
+
+private:
+  std::span<const Word> _image;
+  std::size_t _size   = 0;
+  std::size_t _ones   = 0;
+  std::size_t _blocks = 0;
+  const Word* _samples1 = nullptr;
+  const Word* _samples0 = nullptr;
+
+  const Word* _block(std::size_t b) const noexcept
+    { return _image.data() + HeaderWords + b * BlockStride; }
+
+  std::size_t _abs(std::size_t b) const noexcept
+    { return static_cast<std::size_t>(_block(b)[0].value()); }
+
+  static constexpr std::size_t _nsamples(std::size_t count) noexcept
+    { return (count + SampleRate - 1) / SampleRate; }
+
+  // Range [lo, hi) of blocks that holds the bit of rank r, from samples.
+  std::pair<std::size_t, std::size_t> _between(const Word* samples,
+                                               std::size_t count,
+                                               std::size_t r) const noexcept
+  {
+    const auto k = r / SampleRate;
+    auto block = [&](std::size_t j) {
+      return std::min(static_cast<std::size_t>(samples[j].value()),
+                      _blocks - 1); // a corrupt sample stays in bounds
+    };
+    const auto lo = block(k);
+    const auto hi = (k + 1 < _nsamples(count)) ? block(k + 1) + 1 : _blocks;
+    return {lo, std::max(lo + 1, hi)};
+  }
+
+  // Ones before data word j (0..7) of a block, given its packed counts.
+  static constexpr std::size_t _rel(std::uint64_t packed, std::size_t j) noexcept
+    { return j ? (packed >> (9 * (j - 1))) & 0x1ff : 0; }
+
+public:
+  /// Number of words needed for the image of an nbits-long bitvector. The
+  /// samples of ones and of zeros together take at most nbits / 512 + 2.
+  static constexpr std::size_t image_size(std::size_t nbits) noexcept {
+    return HeaderWords + (nbits + BlockBits - 1) / BlockBits * BlockStride
+         + nbits / SampleRate + 2;
+  }
+
+  /// Build an image into out, which must hold image_size(nbits) words.
+  /// @param bits native words, bit i is bit i%64 of bits[i/64]
+  /// @param nbits number of valid bits; trailing bits of bits are ignored
+  /// @param out destination image
+  static void encode(std::span<const std::uint64_t> bits, std::size_t nbits,
+                     std::span<Word> out) noexcept
+  {
+    auto blocks = (nbits + BlockBits - 1) / BlockBits;
+    auto nwords = (nbits + WordBits - 1) / WordBits;
+    auto word = [&](std::size_t w) {
+      std::uint64_t x = (w < nwords) ? bits[w] : 0;
+      if (w + 1 == nwords && nbits % WordBits != 0)
+        x &= (std::uint64_t{1} << (nbits % WordBits)) - 1;
+      return x;
+    };
+    std::size_t total = 0;
+    for (std::size_t w = 0; w != nwords; ++w)
+      total += static_cast<std::size_t>(std::popcount(word(w)));
+    auto* samples1 = out.data() + HeaderWords + blocks * BlockStride;
+    auto* samples0 = samples1 + _nsamples(total);
+    std::fill(samples0 + _nsamples(nbits - total),
+              out.data() + image_size(nbits), Word{});
+    std::size_t next1 = 0; // rank of the next one to sample
+    std::size_t next0 = 0;
+    std::uint64_t ones = 0;
+    for (std::size_t b = 0; b != blocks; ++b) {
+      auto* blk = out.data() + HeaderWords + b * BlockStride;
+      blk[0] = ones;
+      std::uint64_t packed = 0;
+      std::uint64_t rel    = 0;
+      for (std::size_t j = 0; j != BlockWords; ++j) {
+        auto x = word(b * BlockWords + j);
+        if (j != 0)
+          packed |= rel << (9 * (j - 1));
+        rel += static_cast<std::uint64_t>(std::popcount(x));
+        blk[2 + j] = x;
+      }
+      blk[1] = packed;
+      ones += rel;
+      const auto zeros = std::min((b + 1) * BlockBits, nbits) - ones;
+      for (; next1 < ones; next1 += SampleRate)
+        samples1[next1 / SampleRate] = std::uint64_t{b};
+      for (; next0 < zeros; next0 += SampleRate)
+        samples0[next0 / SampleRate] = std::uint64_t{b};
+    }
+    out[0] = std::uint64_t{nbits};
+    out[1] = ones;
+  } // encode
+
+  /// Build and return an image.
+  static std::vector<Word> encode(std::span<const std::uint64_t> bits,
+                                  std::size_t nbits)
+  {
+    auto image = std::vector<Word>(image_size(nbits));
+    encode(bits, nbits, image);
+    return image;
+  }
+
+  /// @name Constructors
+  /// @{
+  constexpr RankSelect() noexcept = default;
+
+  /// View an existing image, e.g. one that was memory-mapped from a file.
+  /// The image must outlive the view.
+  /// @throws std::invalid_argument if the image is shorter than its header,
+  /// or than image_size() of its bit count, or counts more ones than bits
+  explicit RankSelect(std::span<const Word> image) : _image{image} {
+    if (image.size() < HeaderWords)
+      throw std::invalid_argument{"RankSelect: image too short"};
+    const auto nbits = image[0].value();
+    const auto ones  = image[1].value();
+    const auto blocks = (image.size() - HeaderWords) / BlockStride;
+    if (nbits > blocks * BlockBits || ones > nbits
+        || image.size() < image_size(static_cast<std::size_t>(nbits)))
+    {
+      throw std::invalid_argument{"RankSelect: bad image"};
+    }
+    _size = static_cast<std::size_t>(nbits);
+    _ones = static_cast<std::size_t>(ones);
+    _blocks = (_size + BlockBits - 1) / BlockBits;
+    _samples1 = _block(_blocks);
+    _samples0 = _samples1 + _nsamples(_ones);
+  }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] std::size_t size()  const noexcept { return _size; }
+  [[nodiscard]] bool        empty() const noexcept { return _size == 0; }
+  [[nodiscard]] std::size_t count() const noexcept { return _ones; }
+  [[nodiscard]] std::span<const Word> image() const noexcept { return _image; }
+
+  /// Return bit i, which must be less than size().
+  [[nodiscard]] bool test(std::size_t i) const noexcept
+    { return (word(i / WordBits) >> (i % WordBits)) & 1; }
+
+  [[nodiscard]] bool operator[](std::size_t i) const noexcept { return test(i); }
+
+  /// Return data word k (bits [64k, 64k+64)) in host byte order.
+  [[nodiscard]] std::uint64_t word(std::size_t k) const noexcept
+    { return _block(k / BlockWords)[2 + k % BlockWords].value(); }
+  /// @}
+
+  /// @name Rank
+  /// @{
+  /// Number of set bits in [0, i).
+  [[nodiscard]] std::size_t rank1(std::size_t i) const noexcept {
+    if (i >= _size)
+      return _ones;
+    const auto* blk = _block(i / BlockBits);
+    auto j = i % BlockBits / WordBits;
+    auto mask = (std::uint64_t{1} << (i % WordBits)) - 1;
+    return static_cast<std::size_t>(blk[0].value())
+         + _rel(blk[1].value(), j)
+         + static_cast<std::size_t>(std::popcount(blk[2 + j].value() & mask));
+  }
+
+  /// Number of clear bits in [0, i).
+  [[nodiscard]] std::size_t rank0(std::size_t i) const noexcept
+    { return std::min(i, _size) - rank1(i); }
+  /// @}
+
+  /// @name Select
+  /// @{
+  /// Position of the set bit of rank r (zero-based), or size() if r >= count().
+  [[nodiscard]] std::size_t select1(std::size_t r) const noexcept {
+    if (r >= _ones)
+      return _size;
+    auto [lo, hi] = _between(_samples1, _ones, r);
+    while (hi - lo > 1) {
+      auto mid = lo + (hi - lo) / 2;
+      if (_abs(mid) <= r)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    const auto* blk = _block(lo);
+    r -= _abs(lo);
+    auto packed = blk[1].value();
+    std::size_t j = 0;
+    while (j + 1 != BlockWords && _rel(packed, j + 1) <= r)
+      ++j;
+    r -= _rel(packed, j);
+    return lo * BlockBits + j * WordBits
+         + select64(blk[2 + j].value(), static_cast<unsigned>(r));
+  } // select1
+
+  /// Position of the clear bit of rank r (zero-based), or size() if
+  /// r >= size() - count().
+  [[nodiscard]] std::size_t select0(std::size_t r) const noexcept {
+    if (r >= _size - _ones)
+      return _size;
+    auto [lo, hi] = _between(_samples0, _size - _ones, r);
+    while (hi - lo > 1) {
+      auto mid = lo + (hi - lo) / 2;
+      if (mid * BlockBits - _abs(mid) <= r)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    const auto* blk = _block(lo);
+    r -= lo * BlockBits - _abs(lo);
+    auto packed = blk[1].value();
+    std::size_t j = 0;
+    while (j + 1 != BlockWords && (j + 1) * WordBits - _rel(packed, j+1) <= r)
+      ++j;
+    r -= j * WordBits - _rel(packed, j);
+    return lo * BlockBits + j * WordBits
+         + select64(~blk[2 + j].value(), static_cast<unsigned>(r));
+  } // select0
+  /// @}
+}; // RankSelect
+
+} // tjg
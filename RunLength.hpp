@@ -0,0 +1,180 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Run-length encoding of fixed-endian Int columns.
+/// @details
+/// Defines ::tjg::RunLength<T, E>, a read-only view over a run-length encoded
+/// column: one Int<T, E> value per run and the Int<std::uint32_t, E> end
+/// position of each run. Both arrays are fixed-endian, so an encoded column can
+/// be written to a file and mapped back on any host. Encoding finds runs by
+/// comparing raw storage (::tjg::find_not), so nothing is swapped; decoding
+/// swaps once per run and fills. Predicates are evaluated once per run.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <algorithm>  // std::ranges::upper_bound
+#include <bit>        // std::endian
+#include <cstdint>    // std::uint32_t, std::uint64_t
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// Read-only view over a run-length encoded column of up to 2^32-1 values.
+/// Run r holds value values[r] at positions [ends[r-1], ends[r]).
+template<std::integral T, std::endian E = std::endian::native>
+class RunLength {
+public:
+  using value_type = T;
+  using Value = Int<T, E>;
+  using End   = Int<std::uint32_t, E>;
+  static constexpr std::endian Endian = E;
+
+private:
+  std::span<const Value> _values;
+  std::span<const End>   _ends;
+
+  std::size_t _begin(std::size_t r) const noexcept
+    { return r ? std::size_t{_ends[r - 1].value()} : 0; }
+
+  std::size_t _end(std::size_t r) const noexcept
+    { return std::size_t{_ends[r].value()}; }
+
+  // Set bits [first, last) of a selection bitmask.
+  static void _setBits(std::span<std::uint64_t> bits,
+                       std::size_t first, std::size_t last) noexcept
+  {
+    if (first == last)
+      return;
+    auto w0 = first / 64;
+    auto w1 = (last - 1) / 64;
+    auto m0 = ~std::uint64_t{0} << (first % 64);
+    auto m1 = ~std::uint64_t{0} >> (63 - (last - 1) % 64);
+    if (w0 == w1) {
+      bits[w0] |= m0 & m1;
+      return;
+    }
+    bits[w0] |= m0;
+    for (auto w = w0 + 1; w != w1; ++w)
+      bits[w] = ~std::uint64_t{0};
+    bits[w1] |= m1;
+  } // _setBits
+
+public:
+  /// Return the number of runs in in.
+  template<std::endian E2>
+  static std::size_t count_runs(std::span<const Int<T, E2>> in) noexcept {
+    std::size_t runs = 0;
+    for (std::size_t i = 0; i != in.size(); ++runs)
+      i += find_not(in.subspan(i), in[i]);
+    return runs;
+  }
+
+  /// Encode in, which must have fewer than 2^32 elements.
+  /// @param values destination run values, room for count_runs(in) elements
+  /// @param ends   destination run ends, room for count_runs(in) elements
+  /// @return the number of runs written
+  template<std::endian E2>
+  static std::size_t encode(std::span<const Int<T, E2>> in,
+                            std::span<Value> values, std::span<End> ends)
+    noexcept
+  {
+    std::size_t runs = 0;
+    for (std::size_t i = 0; i != in.size(); ++runs) {
+      values[runs] = in[i];
+      i += find_not(in.subspan(i), in[i]);
+      ends[runs] = End{static_cast<std::uint32_t>(i)};
+    }
+    return runs;
+  } // encode
+
+  /// @name Constructors
+  /// @{
+  constexpr RunLength() noexcept = default;
+
+  /// View existing run arrays of equal length. They must outlive the view.
+  RunLength(std::span<const Value> values, std::span<const End> ends) noexcept
+    : _values{values}, _ends{ends} { }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  /// Number of decoded values.
+  [[nodiscard]] std::size_t size() const noexcept
+    { return _ends.empty() ? 0 : _end(_ends.size() - 1); }
+
+  [[nodiscard]] bool empty() const noexcept { return _ends.empty(); }
+
+  /// Number of runs.
+  [[nodiscard]] std::size_t runs() const noexcept { return _ends.size(); }
+
+  [[nodiscard]] std::span<const Value> values() const noexcept
+    { return _values; }
+  [[nodiscard]] std::span<const End> ends() const noexcept { return _ends; }
+
+  /// Return the run containing position i, which must be less than size().
+  [[nodiscard]] std::size_t run(std::size_t i) const noexcept {
+    auto it = std::ranges::upper_bound(_ends, i, {},
+                    [](End e) { return std::size_t{e.value()}; });
+    return static_cast<std::size_t>(it - _ends.begin());
+  }
+
+  /// Return value i, which must be less than size().
+  [[nodiscard]] T operator[](std::size_t i) const noexcept
+    { return _values[run(i)].value(); }
+  /// @}
+
+  /// Decode into out, which must hold size() elements, in byte order E2.
+  template<std::endian E2>
+  void decode(std::span<Int<T, E2>> out) const noexcept {
+    for (std::size_t r = 0; r != runs(); ++r) {
+      auto first = _begin(r);
+      fill(out.subspan(first, _end(r) - first), _values[r].value());
+    }
+  }
+
+  /// @name Predicates on runs
+  /// Each predicate is called once per run with the run's native value.
+  /// @{
+  /// Number of values for which pred(value) is true.
+  template<typename Pred>
+  [[nodiscard]] std::size_t count_if(Pred pred) const {
+    std::size_t count = 0;
+    for (std::size_t r = 0; r != runs(); ++r) {
+      if (pred(_values[r].value()))
+        count += _end(r) - _begin(r);
+    }
+    return count;
+  }
+
+  /// Call fn(first, last) for each maximal range of positions whose values
+  /// satisfy pred.
+  template<typename Pred, typename Fn>
+  void for_each_if(Pred pred, Fn fn) const {
+    // Test each run once: run e, which ends a range, failed pred already.
+    for (std::size_t r = 0; r < runs(); ++r) {
+      if (!pred(_values[r].value()))
+        continue;
+      auto e = r + 1;
+      while (e != runs() && pred(_values[e].value()))
+        ++e;
+      fn(_begin(r), _end(e - 1));
+      r = e;
+    }
+  } // for_each_if
+
+  /// Set bit i of bits (bit i%64 of bits[i/64]) for each position i whose
+  /// value satisfies pred. Other bits are left unchanged; bits must hold
+  /// (size() + 63) / 64 words.
+  template<typename Pred>
+  void select(Pred pred, std::span<std::uint64_t> bits) const {
+    for_each_if(pred,
+          [&](std::size_t first, std::size_t last)
+            { _setBits(bits, first, last); });
+  }
+  /// @}
+}; // RunLength
+
+} // tjg
@@ -0,0 +1,208 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Prefix sums over fixed-endian Int spans.
+/// @details
+/// ::tjg::inclusive_scan() and ::tjg::exclusive_scan() read a
+/// std::span<const Int<T, E1>>, such as an array of big-endian lengths, and
+/// write running totals to a std::span<Int<U, E2>> of the same or wider type,
+/// such as native offsets. Each vector of input is swapped, widened to U and
+/// prefix-summed in registers with log2(lanes) shift-and-add steps, then
+/// swapped to E2 and stored, all in one pass.
+///
+/// The parallel_ variants split the input among threads in two phases: each
+/// thread first sums its chunk, then scans it starting from the total of the
+/// chunks before it. A single scan is bound by memory bandwidth, so threads
+/// only pay off on very large arrays; by default they are used from
+/// ::tjg::ParallelScanMin elements up. Sums wrap modulo 2^bits(U).
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>         // std::span
+#include <algorithm>    // std::min, std::max
+#include <thread>       // std::jthread, std::thread::hardware_concurrency
+#include <type_traits>  // std::make_unsigned_t, std::type_identity_t
+#include <utility>      // std::index_sequence
+#include <vector>       // std::vector
+#include <bit>          // std::endian
+#include <cstring>      // std::memcpy
+#include <cstddef>      // std::size_t
+
+namespace tjg {
+
+/// Smallest input for which the parallel_ scans start threads by default.
+inline constexpr std::size_t ParallelScanMin = 100'000'000;
+
+namespace detail {
+
+#if TJG_INT_SIMD
+/// Load Lanes<W> elements of storage order E at p as a native Vec<W>.
+template<typename W, std::endian E, typename T>
+[[gnu::always_inline]] inline Vec<W> vwiden(const T* p) noexcept {
+  using V [[gnu::vector_size(Lanes<W> * sizeof(T))]] = T;
+  V v;
+  std::memcpy(&v, p, sizeof(v));
+  return __builtin_convertvector(vnative<E>(v), Vec<W>);
+}
+
+template<std::size_t K, typename V, std::size_t... I>
+[[gnu::always_inline]]
+inline V vshift_up(V v, std::index_sequence<I...>) noexcept {
+  constexpr std::size_t N = sizeof...(I);
+  return __builtin_shufflevector(V{}, v, (I >= K ? N + I - K : 0)...);
+}
+
+/// Inclusive prefix sum of the lanes of v.
+template<std::size_t K = 1, typename V>
+[[gnu::always_inline]] inline V vprefix(V v) noexcept {
+  constexpr std::size_t N = sizeof(V) / sizeof(v[0]);
+  if constexpr (K >= N)
+    return v;
+  else
+    return vprefix<2 * K>(v + vshift_up<K>(v, std::make_index_sequence<N>{}));
+}
+#endif
+
+/// Sum of the elements of in, widened to U.
+template<std::integral U, std::integral T, std::endian E>
+U scan_sum(std::span<const Int<T, E>> in) noexcept {
+  using W = std::make_unsigned_t<U>;
+  const auto n = in.size();
+  std::size_t i = 0;
+  W acc = 0;
+#if TJG_INT_SIMD
+  constexpr auto L = Lanes<W>;
+  const T* p = raw_data(in);
+  Vec<W> sum{};
+  for (; i + L <= n; i += L)
+    sum += vwiden<W, E>(p + i);
+  for (std::size_t k = 0; k != L; ++k)
+    acc += sum[k];
+#endif
+  for (; i != n; ++i)
+    acc += static_cast<W>(in[i].value());
+  return static_cast<U>(acc);
+} // scan_sum
+
+/// Write the running totals of in, starting from init, to out. Returns init
+/// plus the sum of in.
+template<bool Exclusive, std::integral T, std::endian E1,
+         std::integral U, std::endian E2>
+U scan(std::span<const Int<T, E1>> in, std::span<Int<U, E2>> out, U init)
+  noexcept
+{
+  using W = std::make_unsigned_t<U>;
+  const auto n = in.size();
+  std::size_t i = 0;
+  W acc = static_cast<W>(init);
+#if TJG_INT_SIMD
+  constexpr auto L = Lanes<W>;
+  const T* p = raw_data(in);
+  U* q = raw_data(out);
+  for (; i + L <= n; i += L) {
+    auto x = vwiden<W, E1>(p + i);
+    auto r = vprefix(x) + acc;
+    acc = r[L - 1];
+    if constexpr (Exclusive)
+      r -= x;
+    vstore(q + i, vnative<E2>(r));
+  }
+#endif
+  for (; i != n; ++i) {
+    auto x = static_cast<W>(in[i].value());
+    out[i] = Int<U, E2>{static_cast<U>(Exclusive ? acc : acc + x)};
+    acc += x;
+  }
+  return static_cast<U>(acc);
+} // scan
+
+/// Two-phase parallel scan of in over the given number of threads (0 picks
+/// one per core from ParallelScanMin elements up, else a single thread).
+template<bool Exclusive, std::integral T, std::endian E1,
+         std::integral U, std::endian E2>
+U parallel_scan(std::span<const Int<T, E1>> in, std::span<Int<U, E2>> out,
+                U init, unsigned threads)
+{
+  const auto n = in.size();
+  if (threads == 0)
+    threads = (n >= ParallelScanMin) ? std::thread::hardware_concurrency() : 1;
+  threads = std::max(threads, 1u);
+  const std::size_t chunk = (n + threads - 1) / threads;
+  const std::size_t parts = (chunk == 0) ? 0 : (n + chunk - 1) / chunk;
+  if (parts <= 1)
+    return scan<Exclusive>(in, out, init);
+  auto part = [&](auto s, std::size_t t) {
+    return s.subspan(t * chunk, std::min(chunk, n - t * chunk));
+  };
+  std::vector<U> base(parts);
+  {
+    std::vector<std::jthread> pool;
+    pool.reserve(parts - 2);
+    for (std::size_t t = 0; t + 2 != parts; ++t)
+      pool.emplace_back([&, t] { base[t + 1] = scan_sum<U>(part(in, t)); });
+    base[parts - 1] = scan_sum<U>(part(in, parts - 2));
+  }
+  using W = std::make_unsigned_t<U>;
+  base[0] = init;
+  for (std::size_t t = 1; t != parts; ++t)
+    base[t] = static_cast<U>(static_cast<W>(base[t - 1])
+                             + static_cast<W>(base[t]));
+  U total;
+  {
+    std::vector<std::jthread> pool;
+    pool.reserve(parts - 1);
+    for (std::size_t t = 0; t + 1 != parts; ++t) {
+      pool.emplace_back([&, t] {
+        scan<Exclusive>(part(in, t), part(out, t), base[t]);
+      });
+    }
+    total = scan<Exclusive>(part(in, parts - 1), part(out, parts - 1),
+                            base[parts - 1]);
+  }
+  return total;
+} // parallel_scan
+
+} // detail
+
+/// @name Scans
+/// Write running totals of in to out, which must have room for in.size()
+/// elements. U must be at least as wide as T.
+/// @return init plus the sum of in, e.g. the end offset of the last element
+/// @{
+/// out[i] = init + in[0] + ... + in[i].
+template<std::integral T, std::endian E1, std::integral U, std::endian E2>
+requires (sizeof(U) >= sizeof(T))
+U inclusive_scan(std::span<const Int<T, E1>> in, std::span<Int<U, E2>> out,
+                 std::type_identity_t<U> init = 0) noexcept
+  { return detail::scan<false>(in, out, init); }
+
+/// out[i] = init + in[0] + ... + in[i-1]; turns lengths into offsets.
+template<std::integral T, std::endian E1, std::integral U, std::endian E2>
+requires (sizeof(U) >= sizeof(T))
+U exclusive_scan(std::span<const Int<T, E1>> in, std::span<Int<U, E2>> out,
+                 std::type_identity_t<U> init = 0) noexcept
+  { return detail::scan<true>(in, out, init); }
+
+/// inclusive_scan() split over threads; 0 threads uses one per core for
+/// inputs of at least ParallelScanMin elements and one thread otherwise.
+template<std::integral T, std::endian E1, std::integral U, std::endian E2>
+requires (sizeof(U) >= sizeof(T))
+U parallel_inclusive_scan(std::span<const Int<T, E1>> in,
+                          std::span<Int<U, E2>> out,
+                          std::type_identity_t<U> init = 0,
+                          unsigned threads = 0)
+  { return detail::parallel_scan<false>(in, out, init, threads); }
+
+/// exclusive_scan() split over threads, as for parallel_inclusive_scan().
+template<std::integral T, std::endian E1, std::integral U, std::endian E2>
+requires (sizeof(U) >= sizeof(T))
+U parallel_exclusive_scan(std::span<const Int<T, E1>> in,
+                          std::span<Int<U, E2>> out,
+                          std::type_identity_t<U> init = 0,
+                          unsigned threads = 0)
+  { return detail::parallel_scan<true>(in, out, init, threads); }
+/// @}
+
+} // tjg
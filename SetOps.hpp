@@ -0,0 +1,210 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Intersection and union of sorted fixed-endian Int sets.
+/// @details
+/// ::tjg::set_intersection() and ::tjg::set_union() combine two strictly
+/// increasing std::span<const Int<T, E>>, such as posting lists of BigUint32
+/// document IDs, and write the result in either byte order.
+///
+/// Equality does not depend on byte order, so the intersection compares raw
+/// storage. For 32- and 64-bit elements it compares a vector of each input
+/// against every rotation of the other, as in Lemire, Boytsov & Kurz, "SIMD
+/// Compression and the Intersection of Sorted Integers"; for 16-bit elements
+/// with SSE4.2 a single pcmpestrm compares all 8 x 8 pairs. Only the last
+/// element of each block is swapped, to decide which input advances. When one
+/// input is more than ::tjg::GallopRatio times longer than the other, each
+/// element of the short one is instead found in the long one by galloping
+/// (exponential then binary search).
+///
+/// The union is a merge; whole vectors of one input that lie below the head
+/// of the other are copied with a single shuffle to the output byte order.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <algorithm>  // std::min, std::ranges::lower_bound
+#include <utility>    // std::index_sequence
+#include <bit>        // std::endian, std::countr_zero
+#include <cstdint>    // std::uint32_t
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// Size ratio from which set_intersection() gallops through the longer input.
+inline constexpr std::size_t GallopRatio = 32;
+
+namespace detail {
+
+/// Intersect a short set with a much longer one by galloping through long.
+template<std::integral T, std::endian E1, std::endian E2>
+std::size_t gallop_intersection(std::span<const Int<T, E1>> small,
+                                std::span<const Int<T, E1>> large,
+                                std::span<Int<T, E2>> out) noexcept
+{
+  std::size_t count = 0;
+  std::size_t j = 0;
+  const auto n = large.size();
+  for (auto x: small) {
+    std::size_t step = 1;
+    while (j + step < n && large[j + step] < x)
+      step *= 2;
+    auto first = large.begin() + static_cast<std::ptrdiff_t>(j + step / 2);
+    auto last  = large.begin()
+               + static_cast<std::ptrdiff_t>(std::min(j + step + 1, n));
+    j = static_cast<std::size_t>(std::ranges::lower_bound(first, last, x)
+                                 - large.begin());
+    if (j == n)
+      break;
+    if (large[j] == x) {
+      out[count++] = Int<T, E2>{x.value()};
+      ++j;
+    }
+  }
+  return count;
+} // gallop_intersection
+
+#if TJG_INT_SIMD
+template<std::size_t K, typename V, std::size_t... I>
+[[gnu::always_inline]]
+inline V vrotate(V v, std::index_sequence<I...>) noexcept
+  { return __builtin_shufflevector(v, v, ((I + K) % sizeof...(I))...); }
+
+/// Lanes of a equal to some lane of b, all ones or all zeros.
+template<typename V, std::size_t... K>
+[[gnu::always_inline]]
+inline auto vmatch_any(V a, V b, std::index_sequence<K...> seq) noexcept
+  { return (... | (a == vrotate<K>(b, seq))); }
+#endif
+
+} // detail
+
+/// Write the elements common to a and b, in increasing order, to out, which
+/// must have room for std::min(a.size(), b.size()) elements. a and b must be
+/// strictly increasing.
+/// @return the number of elements written
+template<std::integral T, std::endian E1, std::endian E2>
+std::size_t set_intersection(std::span<const Int<T, E1>> a,
+                             std::span<const Int<T, E1>> b,
+                             std::span<Int<T, E2>> out) noexcept
+{
+  if (a.size() > GallopRatio * b.size())
+    return detail::gallop_intersection(b, a, out);
+  if (b.size() > GallopRatio * a.size())
+    return detail::gallop_intersection(a, b, out);
+  [[maybe_unused]] const T* p = detail::raw_data(a);
+  [[maybe_unused]] const T* q = detail::raw_data(b);
+  const auto na = a.size();
+  const auto nb = b.size();
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t j = 0;
+  [[maybe_unused]] auto emit = [&](std::uint32_t bits) {
+    for (; bits != 0; bits &= bits - 1) {
+      const auto k = static_cast<std::size_t>(std::countr_zero(bits));
+      out[count++] = Int<T, E2>{a[i + k].value()};
+    }
+  };
+#if TJG_INT_SIMD && defined(__SSE4_2__)
+  if constexpr (sizeof(T) == 2) {
+    constexpr int Mode = _SIDD_UWORD_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK;
+    for (; i + 8 <= na && j + 8 <= nb; ) {
+      auto va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+      auto vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q + j));
+      auto m = _mm_cmpestrm(vb, 8, va, 8, Mode);
+      emit(static_cast<std::uint32_t>(_mm_cvtsi128_si32(m)));
+      const T amax = a[i + 7].value();
+      const T bmax = b[j + 7].value();
+      if (amax <= bmax)
+        i += 8;
+      if (bmax <= amax)
+        j += 8;
+    }
+  }
+#endif
+#if TJG_INT_SIMD
+  if constexpr (sizeof(T) >= 4) {
+    constexpr auto L = detail::Lanes<T>;
+    for (; i + L <= na && j + L <= nb; ) {
+      auto m = detail::vmatch_any(detail::vload(p + i), detail::vload(q + j),
+                                  std::make_index_sequence<L>{});
+      emit(detail::vmovemask(m));
+      const T amax = a[i + L - 1].value();
+      const T bmax = b[j + L - 1].value();
+      if (amax <= bmax)
+        i += L;
+      if (bmax <= amax)
+        j += L;
+    }
+  }
+#endif
+  while (i != na && j != nb) {
+    const T x = a[i].value();
+    const T y = b[j].value();
+    if (x == y)
+      out[count++] = Int<T, E2>{x};
+    i += (x <= y);
+    j += (y <= x);
+  }
+  return count;
+} // set_intersection
+
+/// Write the elements of a or b, in increasing order and without duplicates,
+/// to out, which must have room for a.size() + b.size() elements. a and b
+/// must be strictly increasing.
+/// @return the number of elements written
+template<std::integral T, std::endian E1, std::endian E2>
+std::size_t set_union(std::span<const Int<T, E1>> a,
+                      std::span<const Int<T, E1>> b,
+                      std::span<Int<T, E2>> out) noexcept
+{
+  const auto na = a.size();
+  const auto nb = b.size();
+  std::size_t count = 0;
+  std::size_t i = 0;
+  std::size_t j = 0;
+#if TJG_INT_SIMD
+  constexpr auto L = detail::Lanes<T>;
+  const T* p = detail::raw_data(a);
+  const T* q = detail::raw_data(b);
+  T* r = detail::raw_data(out);
+  // Copy a block of L elements of s at k when it lies wholly below y.
+  auto copy_below = [&](const T* s, std::span<const Int<T, E1>> in,
+                        std::size_t& k, T y)
+  {
+    while (k + L <= in.size() && in[k + L - 1].value() < y) {
+      auto v = detail::vconvert<E1, E2>(detail::vload(s + k));
+      detail::vstore(r + count, v);
+      count += L;
+      k += L;
+    }
+  };
+#endif
+  while (i != na && j != nb) {
+#if TJG_INT_SIMD
+    if (a[i] < b[j]) {
+      copy_below(p, a, i, b[j].value());
+      if (i == na)
+        break;
+    } else if (b[j] < a[i]) {
+      copy_below(q, b, j, a[i].value());
+      if (j == nb)
+        break;
+    }
+#endif
+    const T x = a[i].value();
+    const T y = b[j].value();
+    out[count++] = Int<T, E2>{(x < y) ? x : y};
+    i += (x <= y);
+    j += (y <= x);
+  }
+  for (; i != na; ++i)
+    out[count++] = Int<T, E2>{a[i].value()};
+  for (; j != nb; ++j)
+    out[count++] = Int<T, E2>{b[j].value()};
+  return count;
+} // set_union
+
+} // tjg
@@ -0,0 +1,91 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief std::experimental::simd loads and stores of fixed-endian Int.
+/// @details
+/// ::tjg::simd_load() reads simd<T>::size() consecutive Int<T, E> into a
+/// std::experimental::simd<T, Abi> in native order, and ::tjg::simd_store()
+/// writes one back in order E. The byte reversal is folded into the load or
+/// store as one constant shuffle of the whole register (pshufb on x86), the
+/// same shuffle the kernels of IntSpan.hpp use, so hand-written simd code over
+/// big-endian data runs as fast as over native data:
+///
+/// @code
+///   namespace stdx = std::experimental;
+///   stdx::native_simd<std::uint32_t> sum = 0;
+///   for (std::size_t i = 0; i + sum.size() <= n; i += sum.size())
+///     sum += simd_load(p + i);      // p is const BigUint32*
+/// @endcode
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <experimental/simd> // std::experimental::simd
+#include <type_traits> // std::is_trivially_copyable_v
+#include <bit>        // std::endian, std::bit_cast, std::has_single_bit
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+namespace detail {
+
+namespace stdx = std::experimental;
+
+/// Reverse the bytes of every element of a simd, as one vector shuffle when
+/// the simd has a vector's layout.
+template<typename T, typename Abi>
+[[gnu::always_inline]]
+inline stdx::simd<T, Abi> simd_byteswap(stdx::simd<T, Abi> v) noexcept {
+  using S = stdx::simd<T, Abi>;
+  if constexpr (sizeof(T) == 1) {
+    return v;
+  } else {
+#if TJG_INT_SIMD
+    if constexpr (std::is_trivially_copyable_v<S>
+                  && sizeof(S) == S::size() * sizeof(T)
+                  && std::has_single_bit(sizeof(S)))
+    {
+      using R [[gnu::vector_size(sizeof(S))]] = T;
+      return std::bit_cast<S>(vbyteswap(std::bit_cast<R>(v)));
+    }
+#endif
+    return S{[&](auto i) { return std::byteswap(T{v[i]}); }};
+  }
+} // simd_byteswap
+
+} // detail
+
+/// @name Loads
+/// Load the simd<T, Abi>::size() elements at p, in native order. p need only
+/// be aligned as Int<T, E>.
+/// @{
+template<typename Abi, std::integral T, std::endian E>
+[[gnu::always_inline]]
+inline detail::stdx::simd<T, Abi> simd_load(const Int<T, E>* p) noexcept {
+  namespace stdx = detail::stdx;
+  auto v = stdx::simd<T, Abi>{reinterpret_cast<const T*>(p),
+                              stdx::element_aligned};
+  if constexpr (E == std::endian::native)
+    return v;
+  else
+    return detail::simd_byteswap(v);
+}
+
+/// With the native ABI, as std::experimental::native_simd<T>.
+template<std::integral T, std::endian E>
+[[gnu::always_inline]]
+inline detail::stdx::native_simd<T> simd_load(const Int<T, E>* p) noexcept
+  { return simd_load<detail::stdx::simd_abi::native<T>>(p); }
+/// @}
+
+/// Store the elements of v at p, in order E.
+template<std::integral T, std::endian E, typename Abi>
+[[gnu::always_inline]]
+inline void simd_store(Int<T, E>* p, detail::stdx::simd<T, Abi> v) noexcept {
+  if constexpr (E != std::endian::native)
+    v = detail::simd_byteswap(v);
+  v.copy_to(reinterpret_cast<T*>(p), detail::stdx::element_aligned);
+}
+
+} // tjg
@@ -0,0 +1,329 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Parallel radix sort of fixed-endian Int arrays.
+/// @details
+/// ::tjg::parallel_sort() sorts a std::span<Int<T, E>> into increasing
+/// numeric order, optionally moving a parallel payload array along with the
+/// keys. Digits are read straight from raw storage, most significant byte
+/// first for big-endian keys and last for little-endian ones, with the sign
+/// bit flipped for signed T, so no key is ever swapped.
+///
+/// The sort is an MSD partition followed by LSD sorts. Every thread
+/// histograms its share of the input on every byte in one pass; the combined
+/// histograms show the most significant byte on which the keys differ, and all
+/// threads scatter their shares on that byte into 256 buckets of a scratch
+/// array, at offsets computed from the histograms. A bucket larger than one
+/// thread's share, as when most keys are small values with equal top bytes, is
+/// partitioned again the same way over all threads. The threads then take the
+/// other buckets in turn and sort each one with an LSD radix sort on the
+/// remaining bytes, ping-ponging between the scratch array and the bucket's
+/// place in the output; passes in which every key has the same digit are
+/// skipped. Every step is stable, so the sort is stable.
+///
+/// ::tjg::sort_by_field() sorts records by an Int member. It copies the raw
+/// keys out next to their record numbers, radix-sorts those pairs as above, and
+/// then moves each record once to its place, prefetching the records a few
+/// places ahead, instead of swapping two keys at every comparison.
+
+#pragma once
+#include "Int.hpp"
+
+#include <span>         // std::span
+#include <algorithm>    // std::min, std::max, std::copy_n, std::ranges::sort,
+                        // std::ranges::move
+#include <array>        // std::array
+#include <atomic>       // std::atomic
+#include <iterator>     // std::make_move_iterator
+#include <limits>       // std::numeric_limits
+#include <numeric>      // std::iota
+#include <thread>       // std::jthread, std::thread::hardware_concurrency
+#include <type_traits>  // std::is_same_v, std::is_signed_v, std::remove_const_t
+#include <utility>      // std::move, std::exchange
+#include <vector>       // std::vector
+#include <bit>          // std::endian
+#include <cstdint>      // std::uint32_t
+#include <cstddef>      // std::size_t
+
+namespace tjg {
+
+/// Smallest input for which parallel_sort() starts threads by default.
+inline constexpr std::size_t ParallelSortMin = std::size_t{1} << 20;
+
+/// Smallest bucket that parallel_sort() splits across threads.
+inline constexpr std::size_t SplitMin = std::size_t{1} << 14;
+
+namespace detail {
+
+/// Record and key types of a pointer to an Int data member.
+template<typename M>
+struct FieldOf;
+
+template<typename C, std::integral T, std::endian E>
+struct FieldOf<Int<T, E> C::*> {
+  using Record = C;
+  using Key = Int<T, E>;
+};
+
+/// Payload type of a sort with no payload.
+struct NoPayload { };
+
+/// Radix digits of Int<T, E>, read from raw storage.
+template<std::integral T, std::endian E>
+struct RadixKey {
+  static constexpr std::size_t Digits = sizeof(T);
+
+  /// Digit d of x, 0 being the least significant, ordered so that digits
+  /// compare as the numeric values do.
+  static unsigned digit(const Int<T, E>& x, std::size_t d) noexcept {
+    const auto k = (E == std::endian::big) ? Digits - 1 - d : d;
+    unsigned b = reinterpret_cast<const unsigned char*>(&x)[k];
+    if (std::is_signed_v<T> && d == Digits - 1)
+      b ^= 0x80;
+    return b;
+  }
+}; // RadixKey
+
+/// Run fn(t) for t in [0, parts), each on its own thread but the last, which
+/// runs on the caller's.
+template<typename Fn>
+void run_parts(std::size_t parts, Fn fn) {
+  std::vector<std::jthread> pool;
+  pool.reserve(parts - 1);
+  for (std::size_t t = 0; t + 1 < parts; ++t)
+    pool.emplace_back([&fn, t] { fn(t); });
+  fn(parts - 1);
+} // run_parts
+
+/// Sort the n keys (and payloads) at a by digits [0, digits), using b as
+/// scratch of the same size. Returns true if the result is in b, else in a.
+template<std::integral T, std::endian E, typename V>
+bool lsd_sort(Int<T, E>* a, Int<T, E>* b, [[maybe_unused]] V* pa,
+              [[maybe_unused]] V* pb, std::size_t n, std::size_t digits)
+{
+  using Key = RadixKey<T, E>;
+  constexpr bool Payload = !std::is_same_v<V, NoPayload>;
+  if (n <= 32) { // stable insertion sort
+    for (std::size_t i = 1; i < n; ++i) {
+      auto x = a[i];
+      [[maybe_unused]] V y;
+      if constexpr (Payload)
+        y = std::move(pa[i]);
+      auto j = i;
+      for (; j != 0 && x < a[j - 1]; --j) {
+        a[j] = a[j - 1];
+        if constexpr (Payload)
+          pa[j] = std::move(pa[j - 1]);
+      }
+      a[j] = x;
+      if constexpr (Payload)
+        pa[j] = std::move(y);
+    }
+    return false;
+  }
+  bool in_b = false;
+  for (std::size_t d = 0; d != digits; ++d) {
+    auto* src = in_b ? b : a;
+    auto* dst = in_b ? a : b;
+    std::array<std::size_t, 256> count{};
+    for (std::size_t i = 0; i != n; ++i)
+      ++count[Key::digit(src[i], d)];
+    if (std::ranges::find(count, n) != count.end())
+      continue; // every key has the same digit
+    std::size_t sum = 0;
+    for (auto& c: count)
+      sum += std::exchange(c, sum);
+    for (std::size_t i = 0; i != n; ++i) {
+      auto k = count[Key::digit(src[i], d)]++;
+      dst[k] = src[i];
+      if constexpr (Payload)
+        (in_b ? pa : pb)[k] = std::move((in_b ? pb : pa)[i]);
+    }
+    in_b = !in_b;
+  }
+  return in_b;
+} // lsd_sort
+
+/// Move the n keys (and payloads) at a to b.
+template<std::integral T, std::endian E, typename V>
+void move_keys(const Int<T, E>* a, Int<T, E>* b, [[maybe_unused]] V* pa,
+               [[maybe_unused]] V* pb, std::size_t n)
+{
+  std::copy_n(a, n, b);
+  if constexpr (!std::is_same_v<V, NoPayload>)
+    std::copy_n(std::make_move_iterator(pa), n, pb);
+}
+
+/// Sort the n keys (and payloads) at a by digits [0, digits) over up to
+/// threads threads, using b as scratch of the same size, and leave the result
+/// in b if to_b, else in a. Partitions on the highest digit that varies, and
+/// recurses over all threads into buckets larger than one thread's share.
+template<std::integral T, std::endian E, typename V>
+void msd_sort(Int<T, E>* a, Int<T, E>* b, V* pa, V* pb, std::size_t n,
+              std::size_t digits, unsigned threads, bool to_b)
+{
+  using Key = RadixKey<T, E>;
+  using Count = std::array<std::size_t, 256>;
+  constexpr bool Payload = !std::is_same_v<V, NoPayload>;
+  auto at = [](V* p, std::size_t i) { return Payload ? p + i : p; };
+  if (threads < 2 || n < SplitMin) {
+    const bool in_b = lsd_sort(a, b, pa, pb, n, digits);
+    if (in_b && !to_b)
+      move_keys(b, a, pb, pa, n);
+    else if (!in_b && to_b)
+      move_keys(a, b, pa, pb, n);
+    return;
+  }
+  const std::size_t chunk = (n + threads - 1) / threads;
+  const std::size_t parts = (n + chunk - 1) / chunk;
+
+  // Histograms of every digit, per thread.
+  std::vector<std::array<Count, Key::Digits>> count(parts);
+  run_parts(parts, [&](std::size_t t) {
+    auto first = t * chunk;
+    auto last  = std::min(n, first + chunk);
+    auto& c = count[t];
+    for (std::size_t d = 0; d != digits; ++d)
+      c[d].fill(0);
+    for (auto i = first; i != last; ++i) {
+      for (std::size_t d = 0; d != digits; ++d)
+        ++c[d][Key::digit(a[i], d)];
+    }
+  });
+  auto top = digits;
+  while (top != 0) {
+    const auto d = top - 1;
+    const auto x = Key::digit(a[0], d);
+    std::size_t same = 0;
+    for (auto& c: count)
+      same += c[d][x];
+    if (same != n)
+      break;
+    top = d; // every key has the same digit d
+  }
+  if (top == 0) { // all keys equal
+    if (to_b) {
+      run_parts(parts, [&](std::size_t t) {
+        auto first = t * chunk;
+        auto m = std::min(n, first + chunk) - first;
+        move_keys(a + first, b + first, at(pa, first), at(pb, first), m);
+      });
+    }
+    return;
+  }
+  const auto d = top - 1;
+
+  // MSD partition of a into b on digit d.
+  Count bucket{};   // first element of each bucket
+  std::size_t sum = 0;
+  for (std::size_t x = 0; x != 256; ++x) {
+    bucket[x] = sum;
+    for (auto& c: count)
+      sum += std::exchange(c[d][x], sum);
+  }
+  run_parts(parts, [&](std::size_t t) {
+    auto first = t * chunk;
+    auto last  = std::min(n, first + chunk);
+    auto& c = count[t][d];
+    for (auto i = first; i != last; ++i) {
+      auto j = c[Key::digit(a[i], d)]++;
+      b[j] = a[i];
+      if constexpr (Payload)
+        pb[j] = std::move(pa[i]);
+    }
+  });
+
+  // Sort each bucket back from b, so the result lands on the other side.
+  auto size = [&](std::size_t x)
+    { return ((x == 255) ? n : bucket[x + 1]) - bucket[x]; };
+  auto sort = [&](std::size_t x, unsigned th) {
+    auto first = bucket[x];
+    msd_sort(b + first, a + first, at(pb, first), at(pa, first), size(x), d,
+             th, !to_b);
+  };
+  std::array<std::size_t, 256> order;
+  for (std::size_t x = 0; x != 256; ++x)
+    order[x] = x;
+  std::ranges::sort(order, [&](auto x, auto y) { return size(x) > size(y); });
+  std::size_t big = 0;  // buckets split over all threads
+  for (; big != 256 && size(order[big]) > chunk; ++big)
+    sort(order[big], threads);
+  std::atomic<std::size_t> next{big};
+  run_parts(parts, [&](std::size_t) {
+    for (auto i = next++; i < 256 && size(order[i]) != 0; i = next++)
+      sort(order[i], 1);
+  });
+} // msd_sort
+
+template<std::integral T, std::endian E, typename V>
+void radix_sort(std::span<Int<T, E>> keys, V* payload, unsigned threads) {
+  constexpr bool Payload = !std::is_same_v<V, NoPayload>;
+  const auto n = keys.size();
+  if (threads == 0)
+    threads = (n >= ParallelSortMin) ? std::thread::hardware_concurrency() : 1;
+  threads = std::max(threads, 1u);
+  if (n < 2)
+    return;
+  std::vector<Int<T, E>> tmp(n);
+  std::vector<V> ptmp(Payload ? n : 0);
+  msd_sort(keys.data(), tmp.data(), payload, Payload ? ptmp.data() : payload,
+           n, RadixKey<T, E>::Digits, threads, false);
+} // radix_sort
+
+} // detail
+
+/// @name Parallel sort
+/// Sort keys into increasing numeric order with a stable radix sort, over the
+/// given number of threads; 0 uses one per core for inputs of at least
+/// ParallelSortMin elements and one thread otherwise. Allocates scratch space
+/// for a copy of the keys (and payload).
+/// @{
+template<std::integral T, std::endian E>
+void parallel_sort(std::span<Int<T, E>> keys, unsigned threads = 0) {
+  detail::NoPayload* none = nullptr;
+  detail::radix_sort(keys, none, threads);
+}
+
+/// Also apply the same permutation to payload, which must have keys.size()
+/// elements.
+template<std::integral T, std::endian E, typename V>
+void parallel_sort(std::span<Int<T, E>> keys, std::span<V> payload,
+                   unsigned threads = 0)
+  { detail::radix_sort(keys, payload.data(), threads); }
+/// @}
+
+/// Sort records by their Int member Field, e.g.
+/// `sort_by_field<&Record::key>(records)`, stably and over threads as for
+/// parallel_sort(). Records are moved, not swapped, and each only once.
+template<auto Field, typename Record>
+requires std::is_same_v<typename detail::FieldOf<decltype(Field)>::Record,
+                        Record>
+void sort_by_field(std::span<Record> records, unsigned threads = 0) {
+  using Key = detail::FieldOf<decltype(Field)>::Key;
+  constexpr std::size_t Ahead = 16; // records prefetched ahead of the move
+  const auto n = records.size();
+  auto sort = [&]<typename Index>(Index) {
+    std::vector<Key> keys(n);
+    std::vector<Index> idx(n);
+    for (std::size_t i = 0; i != n; ++i)
+      keys[i] = records[i].*Field;
+    std::iota(idx.begin(), idx.end(), Index{0});
+    detail::radix_sort(std::span{keys}, idx.data(), threads);
+    std::vector<Record> tmp;
+    tmp.reserve(n);
+    for (std::size_t i = 0; i != n; ++i) {
+#if defined(__GNUC__)
+      if (i + Ahead < n)
+        __builtin_prefetch(&records[idx[i + Ahead]]);
+#endif
+      tmp.push_back(std::move(records[idx[i]]));
+    }
+    std::ranges::move(tmp, records.begin());
+  };
+  if (n <= std::numeric_limits<std::uint32_t>::max())
+    sort(std::uint32_t{});
+  else
+    sort(std::size_t{});
+} // sort_by_field
+
+} // tjg
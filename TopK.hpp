@@ -0,0 +1,83 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Top-k selection over fixed-endian Int columns.
+/// @details
+/// ::tjg::top_k() finds the k largest elements of a
+/// std::span<const Int<T, E>> and their positions. The current k best are
+/// kept in a min-heap whose root is the threshold a newcomer must beat. Once
+/// the heap is full, each vector of input is swapped with one shuffle and
+/// compared against the threshold in one instruction; only lanes that beat it
+/// reach the heap, so on a large column almost every vector is rejected by a
+/// single compare and movemask.
+///
+/// Ordered comparisons need native values, so it is the vector that is
+/// swapped, not the threshold; a pre-swapped constant only serves equality
+/// tests such as filter_eq().
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <vector>     // std::vector
+#include <algorithm>  // std::min, std::ranges::push_heap, pop_heap, sort_heap
+#include <bit>        // std::endian, std::countr_zero
+#include <cstddef>    // std::size_t
+
+namespace tjg {
+
+/// An element of a column and its position.
+template<std::integral T>
+struct Ranked {
+  T value;
+  std::size_t index;
+  constexpr bool operator==(const Ranked&) const = default;
+}; // Ranked
+
+/// Return the k largest elements of in, largest first. Equal values rank by
+/// position, earliest first. Returns all of in, sorted, if k >= in.size().
+template<std::integral T, std::endian E>
+std::vector<Ranked<T>> top_k(std::span<const Int<T, E>> in, std::size_t k) {
+  using R = Ranked<T>;
+  // a goes before b in the result; the heap root is the last to go.
+  auto better = [](const R& a, const R& b)
+    { return a.value > b.value || (a.value == b.value && a.index < b.index); };
+  std::vector<R> heap;
+  heap.reserve(std::min(k, in.size()));
+  if (k == 0)
+    return heap;
+  // Offer element i; later elements never beat an equal value.
+  auto offer = [&](T x, std::size_t i) {
+    if (heap.size() < k) {
+      heap.push_back({x, i});
+      std::ranges::push_heap(heap, better);
+    } else if (x > heap.front().value) {
+      std::ranges::pop_heap(heap, better);
+      heap.back() = {x, i};
+      std::ranges::push_heap(heap, better);
+    }
+  };
+  const auto n = in.size();
+  std::size_t i = 0;
+  for (; i != n && heap.size() < k; ++i)
+    offer(in[i].value(), i);
+#if TJG_INT_SIMD
+  constexpr auto L = detail::Lanes<T>;
+  const T* p = detail::raw_data(in);
+  for (; i + L <= n; i += L) {
+    auto v = detail::vnative<E>(detail::vload(p + i));
+    auto m = detail::vmovemask(v > detail::vsplat(heap.front().value));
+    for (; m != 0; m &= m - 1) {
+      auto j = static_cast<std::size_t>(std::countr_zero(m));
+      offer(v[j], i + j);
+    }
+  }
+#endif
+  for (; i != n; ++i)
+    offer(in[i].value(), i);
+  std::ranges::sort_heap(heap, better);
+  return heap;
+} // top_k
+
+} // tjg
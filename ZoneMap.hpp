@@ -0,0 +1,182 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+/// @brief Per-block min/max/null-count statistics for fixed-endian Int columns.
+/// @details
+/// Defines ::tjg::ZoneMap<T, E>, a read-only view over the statistics of a
+/// column split into fixed-size blocks ("zones"): the minimum, maximum and
+/// null count of each zone, kept in three fixed-endian arrays that can be
+/// stored next to the column and mapped back on any host. Statistics are
+/// built with ::tjg::min_max(); queries return the row ranges that may hold
+/// values in [lo, hi), so a scan can skip every other block.
+
+#pragma once
+#include "Int.hpp"
+#include "IntSpan.hpp"
+
+#include <span>       // std::span
+#include <vector>     // std::vector
+#include <algorithm>  // std::min, std::max
+#include <limits>     // std::numeric_limits
+#include <bit>        // std::endian, std::popcount
+#include <cstdint>    // std::uint32_t, std::uint64_t
+#include <cstddef>    // std::size_t
+#include <cassert>    // assert
+
+namespace tjg {
+
+/// Read-only view over per-zone statistics of a column of rows() values
+/// split into zones of block() rows (the last zone may be shorter).
+/// A zone whose rows are all null has min > max and never matches a query.
+template<std::integral T, std::endian E = std::endian::native>
+class ZoneMap {
+public:
+  using value_type = T;
+  using Value = Int<T, E>;
+  using Count = Int<std::uint32_t, E>;
+  static constexpr std::endian Endian = E;
+
+  /// Half-open range of rows [first, last).
+  struct Range {
+    std::size_t first;
+    std::size_t last;
+    constexpr bool operator==(const Range&) const = default;
+  }; // Range
+
+private:
+  std::size_t _rows  = 0;
+  std::size_t _block = 0;
+  std::span<const Value> _mins;
+  std::span<const Value> _maxs;
+  std::span<const Count> _nulls;
+
+  // Number of set bits of a validity bitmask in rows [first, last).
+  static std::size_t _countValid(std::span<const std::uint64_t> valid,
+                                 std::size_t first, std::size_t last) noexcept
+  {
+    std::size_t count = 0;
+    for (auto i = first; i != last; ) {
+      auto s = i % 64;
+      auto take = std::min<std::size_t>(64 - s, last - i);
+      auto word = valid[i / 64] >> s;
+      if (take != 64)
+        word &= (std::uint64_t{1} << take) - 1;
+      count += static_cast<std::size_t>(std::popcount(word));
+      i += take;
+    }
+    return count;
+  } // _countValid
+
+public:
+  /// Number of zones for a column of rows values in blocks of block rows;
+  /// block must not be 0.
+  static constexpr std::size_t zones(std::size_t rows, std::size_t block)
+    noexcept
+  {
+    assert(block != 0);
+    return (rows + block - 1) / block;
+  }
+
+  /// Compute zone statistics for column.
+  /// @param column values of the column
+  /// @param block  rows per zone, at least 1 and less than 2^32
+  /// @param mins, maxs, nulls destination arrays of zones(column.size(), block)
+  ///        elements
+  /// @param valid optional validity bitmask, bit i%64 of valid[i/64] set when
+  ///        row i is not null; empty means no nulls
+  template<std::endian E2>
+  static void build(std::span<const Int<T, E2>> column, std::size_t block,
+                    std::span<Value> mins, std::span<Value> maxs,
+                    std::span<Count> nulls,
+                    std::span<const std::uint64_t> valid = {}) noexcept
+  {
+    auto nz = zones(column.size(), block);
+    for (std::size_t z = 0; z != nz; ++z) {
+      auto first = z * block;
+      auto last  = std::min(first + block, column.size());
+      auto stats = MinMax<T>{std::numeric_limits<T>::max(),
+                             std::numeric_limits<T>::min()};
+      auto present = last - first;
+      if (!valid.empty())
+        present = _countValid(valid, first, last);
+      if (present == last - first) {
+        stats = min_max(column.subspan(first, last - first));
+      } else {
+        for (auto i = first; i != last; ++i) {
+          if ((valid[i / 64] >> (i % 64)) & 1) {
+            T x = column[i].value();
+            stats.min = std::min(stats.min, x);
+            stats.max = std::max(stats.max, x);
+          }
+        }
+      }
+      mins[z]  = Value{stats.min};
+      maxs[z]  = Value{stats.max};
+      nulls[z] = Count{static_cast<std::uint32_t>(last - first - present)};
+    }
+  } // build
+
+  /// @name Constructors
+  /// @{
+  constexpr ZoneMap() noexcept = default;
+
+  /// View existing statistics arrays of zones(rows, block) elements each,
+  /// for block of at least 1. They must outlive the view.
+  ZoneMap(std::size_t rows, std::size_t block,
+          std::span<const Value> mins, std::span<const Value> maxs,
+          std::span<const Count> nulls) noexcept
+    : _rows{rows}, _block{block}, _mins{mins}, _maxs{maxs}, _nulls{nulls}
+    { assert(block != 0); }
+  /// @}
+
+  /// @name Observers
+  /// @{
+  [[nodiscard]] std::size_t rows()  const noexcept { return _rows; }
+  [[nodiscard]] std::size_t block() const noexcept { return _block; }
+  [[nodiscard]] std::size_t size()  const noexcept { return _mins.size(); }
+
+  [[nodiscard]] T min(std::size_t z) const noexcept { return _mins[z].value(); }
+  [[nodiscard]] T max(std::size_t z) const noexcept { return _maxs[z].value(); }
+  [[nodiscard]] std::size_t nulls(std::size_t z) const noexcept
+    { return _nulls[z].value(); }
+
+  /// Rows covered by zone z.
+  [[nodiscard]] Range zone_rows(std::size_t z) const noexcept
+    { return {z * _block, std::min((z + 1) * _block, _rows)}; }
+  /// @}
+
+  /// @name Queries
+  /// @{
+  /// True if zone z may hold a non-null value x with lo <= x < hi.
+  [[nodiscard]] bool may_contain(std::size_t z, T lo, T hi) const noexcept {
+    auto r = zone_rows(z);
+    return lo < hi && nulls(z) != r.last - r.first
+        && min(z) < hi && max(z) >= lo;
+  }
+
+  /// Call fn(Range) for each maximal run of adjacent zones that may hold a
+  /// value x with lo <= x < hi.
+  template<typename Fn>
+  void for_each_candidate(T lo, T hi, Fn fn) const {
+    // Test each zone once: zone e, which ends a run, failed already.
+    for (std::size_t z = 0; z < size(); ++z) {
+      if (!may_contain(z, lo, hi))
+        continue;
+      auto e = z + 1;
+      while (e != size() && may_contain(e, lo, hi))
+        ++e;
+      fn(Range{zone_rows(z).first, zone_rows(e - 1).last});
+      z = e;
+    }
+  } // for_each_candidate
+
+  /// Return the row ranges that may hold a value x with lo <= x < hi.
+  [[nodiscard]] std::vector<Range> candidates(T lo, T hi) const {
+    auto ranges = std::vector<Range>{};
+    for_each_candidate(lo, hi, [&](Range r) { ranges.push_back(r); });
+    return ranges;
+  }
+  /// @}
+}; // ZoneMap
+
+} // tjg
@@ -0,0 +1,90 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// BenchSort.cpp — timing of tjg::parallel_sort() against std::sort
+// Sorts random BigUint64 keys at sizes from 1M up to max elements (default
+// 2G, which needs 32 GB), growing by 4x, and prints the sort rate of
+// parallel_sort() on one thread and on every core, and of std::sort with
+// Int::operator<. std::sort is skipped above 256M elements. Keys are drawn
+// from three distributions: uniform 64-bit values; small values below 2^24,
+// whose top bytes are all zero, like ids or counts; and skewed, 90% below
+// 1000 and the rest uniform, so one top-byte bucket holds most keys.
+//
+// Usage: BenchSort [max [threads]]
+// Build:
+//  g++ -std=c++23 -O3 -march=native -I.. BenchSort.cpp -lpthread
+
+#include "Sort.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Key = tjg::BigUint64;
+
+struct Dist {
+  const char* name;
+  std::uint64_t (*draw)(std::mt19937_64&);
+};
+
+constexpr Dist Dists[] = {
+  {"uniform", [](std::mt19937_64& rng) { return rng(); }},
+  {"small",   [](std::mt19937_64& rng) { return rng() % (1u << 24); }},
+  {"skewed",  [](std::mt19937_64& rng)
+                { return (rng() % 10 != 0) ? rng() % 1000 : rng(); }},
+};
+
+template <class Fn>
+double MKeysPerSec(std::size_t n, Fn fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  fn();
+  std::chrono::duration<double> dt = std::chrono::steady_clock::now() - t0;
+  return static_cast<double>(n) / dt.count() / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t max = (argc > 1) ? std::strtoull(argv[1], nullptr, 0)
+                               : std::size_t{2'000'000'000};
+  unsigned threads = (argc > 2)
+                   ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 0))
+                   : std::thread::hardware_concurrency();
+  std::printf("%8s %12s %14s %14s %14s  (Mkeys/s, %u threads)\n",
+              "keys", "n", "radix x1", "radix xN", "std::sort", threads);
+  std::mt19937_64 rng(1);
+  for (auto& dist: Dists) {
+    for (auto n = std::min<std::size_t>(1'000'000, max); ;
+         n = std::min(4 * n, max))
+    {
+      std::vector<Key> src(n);
+      for (auto& k: src)
+        k = Key{dist.draw(rng)};
+      auto keys = src;
+      auto one = MKeysPerSec(n, [&] {
+                   tjg::parallel_sort(std::span{keys}, 1); });
+      keys = src;
+      auto all = MKeysPerSec(n, [&] {
+                   tjg::parallel_sort(std::span{keys}, threads); });
+      double ref = 0;
+      if (n <= (std::size_t{1} << 28)) {
+        keys = src;
+        ref = MKeysPerSec(n, [&] { std::sort(keys.begin(), keys.end()); });
+      }
+      std::printf("%8s %12zu %14.1f %14.1f %14.1f\n",
+                  dist.name, n, one, all, ref);
+      if (n == max)
+        break;
+    }
+  }
+}
@@ -292,3 +292,84 @@ int main() {
   (void)u1; (void)u2;
 }
 #endif
+
+// 12) PASS: consteval tables and wire templates are constant expressions.
+#ifdef PASS_CONSTEVAL_TABLE
+#include <array>
+#include <cstddef>
+
+struct Header {
+  tjg::BigUint16 type;
+  tjg::BigUint16 length;
+  tjg::LilUint32 seq;
+};
+
+constexpr std::array<std::uint32_t, 3> Table{0x01020304u, 0u, 0xa0b0c0d0u};
+constexpr auto BigTable = tjg::to_int_array<std::endian::big>(Table);
+constexpr auto Wire = tjg::to_bytes(Header{tjg::BigUint16{std::uint16_t{1}},
+                                           tjg::BigUint16{std::uint16_t{8}},
+                                           tjg::LilUint32{0x11223344u}});
+
+static_assert(std::is_same_v<decltype(BigTable),
+                             const std::array<tjg::BigUint32, 3>>);
+static_assert(BigTable[0].value() == 0x01020304u);
+static_assert(BigTable[2] == tjg::BigUint32{0xa0b0c0d0u});
+static_assert(std::bit_cast<std::array<std::byte, 4>>(BigTable[0])[0]
+              == std::byte{0x01});
+static_assert(Wire == std::array<std::byte, 8>{
+                        std::byte{0x00}, std::byte{0x01},
+                        std::byte{0x00}, std::byte{0x08},
+                        std::byte{0x44}, std::byte{0x33},
+                        std::byte{0x22}, std::byte{0x11}});
+
+int main() { }
+#endif
+
+// 13) FAIL: to_bytes of a struct with padding is not a constant expression.
+#ifdef FAIL_CONSTEVAL_BYTES_PADDING
+struct Padded {
+  tjg::BigUint16 a;
+  tjg::BigUint32 b;
+};
+
+constexpr auto Wire = tjg::to_bytes(Padded{tjg::BigUint16{std::uint16_t{1}},
+                                           tjg::BigUint32{2u}});
+
+int main() { (void)Wire; }
+#endif
+
+// 14) PASS: fixed-endian literals are constants, usable as case labels.
+#ifdef PASS_LITERALS
+using namespace tjg::literals;
+
+static_assert(std::is_same_v<decltype(0x0800_be16), tjg::BigUint16>);
+static_assert(std::is_same_v<decltype(42_le32),     tjg::LilUint32>);
+static_assert(std::is_same_v<decltype(7_be64),      tjg::BigUint64>);
+static_assert((0x0800_be16).value() == 0x0800);
+static_assert((0x0800_be16).raw()
+              == tjg::BigUint16{std::uint16_t{0x0800}}.raw());
+static_assert((42_le32).raw() == tjg::LilUint32{42u}.raw());
+static_assert((0xffff'ffff'ffff'ffff_le64).value() == ~std::uint64_t{0});
+static_assert(7_be64 == tjg::BigUint64{std::uint64_t{7}});
+
+constexpr tjg::BigUint16 EtherTypes[] = {0x0800_be16, 0x86dd_be16};
+
+int main(int argc, char**) {
+  auto type = tjg::BigUint16::Raw(static_cast<std::uint16_t>(argc));
+  switch (type.raw()) {
+  case (0x0800_be16).raw(): return 4;
+  case (0x86dd_be16).raw(): return 6;
+  default: return EtherTypes[0] == type;
+  }
+}
+#endif
+
+// 15) FAIL: a literal that does not fit its type.
+#ifdef FAIL_LITERAL_OUT_OF_RANGE
+using namespace tjg::literals;
+
+int main() {
+  auto x = 0x10000_be16;
+  (void)x;
+}
+#endif
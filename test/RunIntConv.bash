@@ -88,6 +88,10 @@ run_case PASS_SCALAR_IN_WIDEN
 run_case PASS_SCALAR_IN_NARROW_PAREN
 run_case FAIL_SCALAR_IN_NARROW_BRACE
 run_case PASS_SCALAR_OUT
+run_case PASS_CONSTEVAL_TABLE
+run_case FAIL_CONSTEVAL_BYTES_PADDING
+run_case PASS_LITERALS
+run_case FAIL_LITERAL_OUT_OF_RANGE
 
 if ((fail == 0)); then
   fail_color="${green}"
@@ -0,0 +1,99 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestByteShuffle.cpp — runtime tests for tjg::byte_shuffle/byte_unshuffle
+// Checks plane contents against the numeric value, that the stream does not
+// depend on the source byte order, and round trips into either byte order.
+// Sizes straddle the 16- and 32-element SIMD blocks.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestByteShuffle.cpp -lgtest -lgtest_main -lpthread
+
+#include "ByteShuffle.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class ByteShuffleRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::native>,
+  P<std::uint16_t,  endian::native>,
+  P<std::int16_t,  ~endian::native>,
+  P<std::uint32_t,  endian::native>,
+  P<std::uint32_t, ~endian::native>,
+  P<std::int64_t,   endian::native>,
+  P<std::uint64_t, ~endian::native>
+>;
+TYPED_TEST_SUITE(ByteShuffleRT, Cases);
+
+template <class T>
+static std::vector<T> RandomValues(std::size_t n) {
+  std::mt19937_64 rng(n + sizeof(T));
+  std::vector<T> v(n);
+  for (auto& x: v)
+    x = static_cast<T>(rng());
+  return v;
+}
+
+TYPED_TEST(ByteShuffleRT, PlanesAndRoundTrip) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using U = std::make_unsigned_t<T>;
+  constexpr std::size_t S = sizeof(T);
+
+  for (std::size_t n : {0u, 1u, 15u, 16u, 17u, 31u, 32u, 33u, 100u, 1027u}) {
+    auto vals = RandomValues<T>(n);
+    std::vector<I> in(vals.begin(), vals.end());
+    std::vector<std::byte> planes(n * S);
+    tjg::byte_shuffle(std::span<const I>{in}, std::span{planes});
+
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t k = 0; k < S; ++k) {
+        auto want = static_cast<unsigned char>(
+                        static_cast<U>(vals[i]) >> (8 * (S - 1 - k)));
+        ASSERT_EQ(planes[k * n + i], std::byte{want})
+            << "n=" << n << " i=" << i << " k=" << k;
+      }
+    }
+
+    // The stream is the same whichever byte order it was shuffled from.
+    std::vector<Int<T, ~P::E>> other(vals.begin(), vals.end());
+    std::vector<std::byte> planes2(n * S);
+    tjg::byte_shuffle(std::span<const Int<T, ~P::E>>{other},
+                      std::span{planes2});
+    EXPECT_EQ(planes, planes2);
+
+    std::vector<I> back(n);
+    tjg::byte_unshuffle(std::span<const std::byte>{planes}, std::span{back});
+    EXPECT_EQ(back, in);
+
+    std::vector<Int<T, ~P::E>> flipped(n);
+    tjg::byte_unshuffle(std::span<const std::byte>{planes},
+                        std::span{flipped});
+    EXPECT_EQ(flipped, other);
+  }
+}
+
+} // tjg_test
@@ -0,0 +1,129 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestDistinct.cpp — runtime tests for unique() and HyperLogLog
+// unique() is checked against std::unique on sorted runs of every width;
+// HyperLogLog estimates are checked against the exact count, through an image
+// round trip and a merge of sketches built in different byte orders, and bad
+// precisions and images are rejected.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestDistinct.cpp -lgtest -lgtest_main -lpthread
+
+#include "Distinct.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class UniqueRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,  endian::big>,
+  P<std::int16_t,  endian::little>,
+  P<std::uint32_t, endian::big>,
+  P<std::int32_t,  endian::little>,
+  P<std::uint64_t, endian::big>,
+  P<std::int64_t,  endian::little>
+>;
+TYPED_TEST_SUITE(UniqueRT, Cases);
+
+TYPED_TEST(UniqueRT, MatchesStd) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(8);
+  for (std::size_t n : {0u, 1u, 2u, 9u, 33u, 64u, 100u, 3000u}) {
+    for (unsigned dup : {0u, 1u, 4u, 100u}) { // percent of duplicates
+      std::vector<T> want;
+      T x = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        if (i == 0 || rng() % 100 >= dup)
+          x = static_cast<T>(x + 1 + static_cast<T>(rng() % 3));
+        want.push_back(x);
+      }
+      std::vector<I> v(want.begin(), want.end());
+      want.erase(std::unique(want.begin(), want.end()), want.end());
+      auto k = tjg::unique(std::span{v});
+      ASSERT_EQ(k, want.size()) << "n=" << n << " dup=" << dup;
+      for (std::size_t i = 0; i < k; ++i)
+        ASSERT_EQ(v[i].value(), want[i]) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+TEST(HyperLogLog, Estimate) {
+  for (std::size_t n : {0u, 10u, 1000u, 100'000u, 1'000'000u}) {
+    std::vector<tjg::BigUint32> v;
+    for (std::uint32_t i = 0; i < n; ++i) // each value three times
+      v.insert(v.end(), 3, tjg::BigUint32{i * 2654435761u});
+    std::ranges::shuffle(v, std::mt19937_64(n));
+    auto est = tjg::distinct_count(std::span<const tjg::BigUint32>{v});
+    EXPECT_NEAR(est, static_cast<double>(n), 0.03 * static_cast<double>(n) + 1)
+        << "n=" << n;
+  }
+}
+
+TEST(HyperLogLog, ImageAndMerge) {
+  using Hll = tjg::HyperLogLog<endian::big>;
+  std::vector<tjg::BigUint64> a;
+  std::vector<tjg::LilUint64> b;
+  for (std::uint64_t i = 0; i < 60'000; ++i)
+    a.emplace_back(i);
+  for (std::uint64_t i = 40'000; i < 100'000; ++i)
+    b.emplace_back(i);
+  Hll ha{12}, hb{12};
+  ha.add(std::span<const tjg::BigUint64>{a});
+  hb.add(std::span<const tjg::LilUint64>{b});
+
+  auto img = hb.image();
+  ASSERT_EQ(img.size(), Hll::image_size(12));
+  Hll hb2{std::span<const Hll::Word>{img}};
+  EXPECT_EQ(hb2.precision(), 12u);
+  EXPECT_EQ(hb2.estimate(), hb.estimate());
+
+  ha.merge(hb2);
+  EXPECT_NEAR(ha.estimate(), 100'000.0, 5'000.0);
+}
+
+TEST(HyperLogLog, RejectsBadInput) {
+  using Hll = tjg::HyperLogLog<endian::big>;
+  EXPECT_THROW(Hll{0}, std::invalid_argument);
+  EXPECT_THROW(Hll{19}, std::invalid_argument);
+
+  Hll h12{12}, h14{14};
+  EXPECT_THROW(h12.merge(h14), std::invalid_argument);
+  EXPECT_THROW(h14.merge(h12), std::invalid_argument);
+
+  auto img = h12.image();
+  auto s = std::span<const Hll::Word>{img};
+  EXPECT_THROW(Hll{s.first(0)}, std::invalid_argument);
+  EXPECT_THROW(Hll{s.first(s.size() - 1)}, std::invalid_argument);
+  img[0] = std::uint64_t{0};
+  EXPECT_THROW(Hll{s}, std::invalid_argument);
+  img[0] = std::uint64_t{14}; // registers for p = 12 only
+  EXPECT_THROW(Hll{s}, std::invalid_argument);
+}
+
+} // tjg_test
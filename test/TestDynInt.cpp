@@ -0,0 +1,111 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestDynInt.cpp — runtime tests for with_endian(), endian_from_magic() and
+// DynIntReader
+// TIFF- and pcap-style headers in both byte orders are detected, read field
+// by field, and decoded by a loop instantiated once per byte order.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestDynInt.cpp -lgtest -lgtest_main -lpthread
+
+#include "DynInt.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+// Append x to b in byte order E.
+template <endian E, class T>
+static void Put(std::vector<std::byte>& b, T x) {
+  auto i = Int<T, E>{x};
+  auto n = b.size();
+  b.resize(n + sizeof(i));
+  std::memcpy(b.data() + n, &i, sizeof(i));
+}
+
+// TIFF-like file: "II" or "MM", 42, offset 8, then count and 16-bit values.
+template <endian E>
+static std::vector<std::byte> Tiff(const std::vector<std::uint16_t>& v) {
+  std::vector<std::byte> b;
+  auto tag = std::byte{E == endian::little ? 'I' : 'M'};
+  b.push_back(tag);
+  b.push_back(tag);
+  Put<E>(b, std::uint16_t{42});
+  Put<E>(b, std::uint32_t{8});
+  Put<E>(b, static_cast<std::uint32_t>(v.size()));
+  for (auto x: v)
+    Put<E>(b, x);
+  return b;
+}
+
+template <endian E>
+static std::uint64_t Sum(std::span<const std::byte> b, std::size_t first,
+                         std::size_t n)
+{
+  std::uint64_t sum = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    Int<std::uint16_t, E> x;
+    std::memcpy(&x, b.data() + first + 2 * i, sizeof(x));
+    sum += x.value();
+  }
+  return sum;
+}
+
+TEST(DynInt, WithEndian) {
+  for (auto e: {endian::big, endian::little}) {
+    auto got = tjg::with_endian(e, [&]<endian E> { return E; });
+    EXPECT_EQ(got, e);
+  }
+}
+
+TEST(DynInt, EndianFromMagic) {
+  std::vector<std::byte> pcap;
+  Put<endian::big>(pcap, std::uint32_t{0xa1b2c3d4});
+  EXPECT_EQ(tjg::endian_from_magic<std::uint32_t>(pcap, 0xa1b2c3d4),
+            endian::big);
+  pcap.clear();
+  Put<endian::little>(pcap, std::uint32_t{0xa1b2c3d4});
+  EXPECT_EQ(tjg::endian_from_magic<std::uint32_t>(pcap, 0xa1b2c3d4),
+            endian::little);
+  EXPECT_FALSE(tjg::endian_from_magic<std::uint32_t>(pcap, 0xa1b23c4d));
+  EXPECT_FALSE(tjg::endian_from_magic<std::uint32_t>(
+                 std::span{pcap}.first(3), 0xa1b2c3d4));
+  // A palindromic magic matches both orders, so it decides neither.
+  EXPECT_FALSE(tjg::endian_from_magic<std::uint16_t>(Tiff<endian::big>({}),
+                                                     0x4d4d));
+  EXPECT_FALSE(tjg::endian_from_magic<std::uint16_t>(
+                 Tiff<endian::little>({}), 0x4949));
+}
+
+TEST(DynInt, DecodeOncePerFile) {
+  std::vector<std::uint16_t> v{1, 2, 300, 40000, 65535};
+  std::uint64_t want = 0;
+  for (auto x: v)
+    want += x;
+  for (auto file: {Tiff<endian::big>(v), Tiff<endian::little>(v)}) {
+    ASSERT_EQ(file[0], file[1]);
+    auto e = (file[0] == std::byte{'I'}) ? endian::little : endian::big;
+    auto r = tjg::DynIntReader{file, e};
+    ASSERT_EQ(r.read<std::uint16_t>(2), 42u);
+    auto first = r.read<std::uint32_t>(4);
+    auto n = r.read<std::uint32_t>(first);
+    ASSERT_EQ(n, v.size());
+    EXPECT_EQ(r.read<std::uint16_t>(first + 4 + 6), 40000u);
+    auto sum = r.visit([&]<endian E> { return Sum<E>(file, first + 4, n); });
+    EXPECT_EQ(sum, want);
+  }
+}
+
+} // tjg_test
@@ -0,0 +1,140 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestEliasFano.cpp — runtime tests for tjg::EliasFano<E>
+// Checks access, next_geq() and decode() against the source sequence for both
+// storage byte orders and several densities, and that truncated or corrupt
+// images are rejected.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestEliasFano.cpp -lgtest -lgtest_main -lpthread
+
+#include "EliasFano.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::EliasFano;
+using tjg::Int;
+
+template <endian E_>
+struct P { static constexpr endian E = E_; };
+
+template <class P> class EliasFanoRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<P<endian::native>, P<~endian::native>>;
+TYPED_TEST_SUITE(EliasFanoRT, Cases);
+
+static std::vector<std::uint64_t> SortedValues(std::size_t n,
+                                               std::uint64_t maxGap,
+                                               std::uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+  std::vector<std::uint64_t> v(n);
+  std::uint64_t x = rng() % (maxGap + 1);
+  for (auto& e: v) {
+    e = x;
+    x += rng() % (maxGap + 1);
+  }
+  return v;
+}
+
+// ---------- Random access and bulk decode ----------
+TYPED_TEST(EliasFanoRT, AccessAndDecode) {
+  constexpr auto E = TypeParam::E;
+  for (std::size_t n : {0u, 1u, 2u, 100u, 3000u}) {
+    for (std::uint64_t gap : {0u, 1u, 7u, 1000u, 1u << 30}) {
+      auto v = SortedValues(n, gap, n * 7 + gap);
+      auto image = EliasFano<E>::encode(std::span<const std::uint64_t>{v});
+      EliasFano<E> ef{image};
+      ASSERT_EQ(ef.size(), n);
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(ef[i], v[i]) << "n=" << n << " gap=" << gap << " i=" << i;
+
+      std::vector<tjg::BigUint64> out(n);
+      ef.decode(std::span{out});
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(out[i].value(), v[i]);
+
+      if (n > 10) {
+        std::vector<tjg::LilUint64> part(5);
+        ef.decode(std::span{part}, n / 2);
+        for (std::size_t i = 0; i < part.size(); ++i)
+          EXPECT_EQ(part[i].value(), v[n / 2 + i]);
+      }
+    }
+  }
+}
+
+// ---------- next_geq vs std::lower_bound ----------
+TYPED_TEST(EliasFanoRT, NextGeq) {
+  constexpr auto E = TypeParam::E;
+  std::mt19937_64 rng(42);
+  for (std::uint64_t gap : {0u, 3u, 100u, 1u << 20}) {
+    auto v = SortedValues(2000, gap, gap + 1);
+    auto image = EliasFano<E>::encode(std::span<const std::uint64_t>{v});
+    EliasFano<E> ef{image};
+    auto hi = v.back() + 10;
+    for (int k = 0; k < 2000; ++k) {
+      auto x = rng() % hi;
+      auto want = std::lower_bound(v.begin(), v.end(), x) - v.begin();
+      ASSERT_EQ(ef.next_geq(x), static_cast<std::size_t>(want)) << "x=" << x;
+    }
+    EXPECT_EQ(ef.next_geq(0), 0u);
+    EXPECT_EQ(ef.next_geq(v.back()),
+              static_cast<std::size_t>(
+                  std::lower_bound(v.begin(), v.end(), v.back()) - v.begin()));
+    EXPECT_EQ(ef.next_geq(v.back() + 1), v.size());
+  }
+}
+
+// ---------- Encode from fixed-endian input ----------
+TYPED_TEST(EliasFanoRT, EncodeFromInt) {
+  constexpr auto E = TypeParam::E;
+  std::vector<tjg::BigUint32> in;
+  for (std::uint32_t i = 0; i < 500; ++i)
+    in.emplace_back(i * i);
+  auto image = EliasFano<E>::encode(std::span<const tjg::BigUint32>{in});
+  EliasFano<E> ef{image};
+  ASSERT_EQ(ef.size(), in.size());
+  for (std::size_t i = 0; i < in.size(); ++i)
+    EXPECT_EQ(ef[i], in[i].value());
+
+  // Roughly n * (2 + log2(m/n)) bits, well under the 32 bits per value input.
+  EXPECT_LT(image.size() * 64, in.size() * 32);
+}
+
+// ---------- Truncated or corrupt images are rejected ----------
+TYPED_TEST(EliasFanoRT, RejectsBadImage) {
+  constexpr auto E = TypeParam::E;
+  using Word = typename EliasFano<E>::Word;
+  auto image = EliasFano<E>::encode(
+                 std::span<const std::uint64_t>{SortedValues(3000, 7, 5)});
+  auto s = std::span<const Word>{image};
+  for (std::size_t n : {std::size_t{0}, std::size_t{2}, image.size() / 2,
+                        image.size() - 1})
+  {
+    EXPECT_THROW(EliasFano<E>{s.first(n)}, std::invalid_argument)
+        << "n=" << n;
+  }
+  EXPECT_NO_THROW(EliasFano<E>{s});
+  auto l = image[2];
+  image[2] = std::uint64_t{64};
+  EXPECT_THROW(EliasFano<E>{s}, std::invalid_argument);
+  image[2] = l;
+  image[0] = std::uint64_t{2999}; // n disagrees with the high bits
+  EXPECT_THROW(EliasFano<E>{s}, std::invalid_argument);
+}
+
+} // tjg_test
@@ -0,0 +1,86 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestEndianAccessor.cpp — runtime tests for endian_accessor and
+// copy_to_native()
+// A big-endian 16-bit image is read through the accessor (by std::mdspan
+// when the library has it, else by calling the policy as mdspan would) and
+// by copying rows and tiles, and both are checked against the native values.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestEndianAccessor.cpp
+//      -lgtest -lgtest_main -lpthread
+
+#include "EndianAccessor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+constexpr std::size_t Height = 37;
+constexpr std::size_t Width  = 101;
+
+static std::uint16_t Pixel(std::size_t r, std::size_t c)
+  { return static_cast<std::uint16_t>(r * 1000 + c * 7); }
+
+static std::vector<tjg::BigUint16> Image() {
+  std::vector<tjg::BigUint16> img(Height * Width);
+  for (std::size_t r = 0; r < Height; ++r)
+    for (std::size_t c = 0; c < Width; ++c)
+      img[r * Width + c] = Pixel(r, c);
+  return img;
+}
+
+TEST(EndianAccessor, Access) {
+  auto img = Image();
+  using A = tjg::endian_accessor<std::uint16_t, endian::big>;
+  static_assert(std::is_same_v<A::element_type, const std::uint16_t>);
+  A acc;
+  auto row = acc.offset(img.data(), 3 * Width);
+  EXPECT_EQ(acc.access(row, 5), Pixel(3, 5));
+#if defined(__cpp_lib_mdspan)
+  auto m = std::mdspan<const std::uint16_t, std::dextents<std::size_t, 2>,
+                       std::layout_right, A>{img.data(), Height, Width};
+  for (std::size_t r = 0; r < Height; ++r)
+    for (std::size_t c = 0; c < Width; ++c)
+      ASSERT_EQ((m[r, c]), Pixel(r, c));
+#else
+  for (std::size_t r = 0; r < Height; ++r)
+    for (std::size_t c = 0; c < Width; ++c)
+      ASSERT_EQ(acc.access(img.data(), r * Width + c), Pixel(r, c));
+#endif
+}
+
+TEST(EndianAccessor, CopyToNative) {
+  auto img = Image();
+  std::vector<std::uint16_t> row(Width);
+  tjg::copy_to_native(std::span<const tjg::BigUint16>{img}.subspan(5 * Width,
+                                                                   Width),
+                      std::span{row});
+  for (std::size_t c = 0; c < Width; ++c)
+    ASSERT_EQ(row[c], Pixel(5, c));
+
+  const std::size_t r0 = 4, c0 = 9, rows = 16, cols = 33;
+  std::vector<std::uint16_t> tile(rows * cols);
+  tjg::copy_to_native(img.data() + r0 * Width + c0, rows, cols, Width,
+                      std::span{tile});
+  for (std::size_t r = 0; r < rows; ++r)
+    for (std::size_t c = 0; c < cols; ++c)
+      ASSERT_EQ(tile[r * cols + c], Pixel(r0 + r, c0 + c));
+}
+
+} // tjg_test
@@ -0,0 +1,141 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestEndianSpan.cpp — runtime tests for EndianSpan<T, E>
+// Random values are written into byte buffers at aligned and misaligned
+// offsets, and every query and in-place operation of the view is checked
+// against plain loops over std::vector<Int>, for lengths that cover several
+// blocks of the misaligned path.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestEndianSpan.cpp -lgtest -lgtest_main -lpthread
+
+#include "EndianSpan.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class EndianSpanRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::big>,
+  P<std::int16_t,   endian::little>,
+  P<std::uint32_t,  endian::big>,
+  P<std::int32_t,   endian::little>,
+  P<std::uint64_t,  endian::big>,
+  P<std::int64_t,   endian::little>
+>;
+TYPED_TEST_SUITE(EndianSpanRT, Cases);
+
+static constexpr std::size_t Sizes[] = {0, 1, 37, 2048, 2049, 5000};
+
+// Buffer holding v at byte offset off, then a partial element.
+template <class I>
+static std::vector<std::byte> Bytes(const std::vector<I>& v, std::size_t off) {
+  std::vector<std::byte> b(off + (v.size() + 1) * sizeof(I) - 1);
+  if (!v.empty())
+    std::memcpy(b.data() + off, v.data(), v.size() * sizeof(I));
+  return b;
+}
+
+template <class I>
+static std::vector<I> Random(std::size_t n, std::mt19937_64& rng) {
+  std::vector<I> v(n);
+  for (auto& x: v)
+    x = I{static_cast<typename I::value_type>(rng() % 1000)};
+  return v;
+}
+
+TYPED_TEST(EndianSpanRT, Queries) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(5);
+  for (auto n: Sizes) {
+    for (std::size_t off: {0u, 1u}) {
+      auto v = Random<I>(n, rng);
+      auto b = Bytes(v, off);
+      auto s = tjg::EndianSpan<const T, P::E>{
+                 std::span<const std::byte>{b}.subspan(off)};
+      ASSERT_EQ(s.size(), n);
+      EXPECT_EQ(s.aligned(), off == 0 || sizeof(T) == 1);
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(s[i], v[i].value());
+
+      auto mm = s.min_max();
+      if (n != 0) {
+        auto [lo, hi] = std::ranges::minmax(v);
+        EXPECT_EQ(mm.min, lo.value());
+        EXPECT_EQ(mm.max, hi.value());
+      }
+
+      std::vector<I> same(n, I{T{7}});
+      if (n != 0)
+        same[n - 1] = I{T{8}};
+      auto sb = Bytes(same, off);
+      auto ss = tjg::EndianSpan<const T, P::E>{
+                  std::span<const std::byte>{sb}.subspan(off)};
+      EXPECT_EQ(ss.find_not(I{T{7}}), n == 0 ? 0 : n - 1);
+      EXPECT_EQ(ss.find_not(I{T{8}}), n == 1 ? 1u : 0u);
+
+      std::vector<Int<T, ~P::E>> out(n);
+      s.copy_to(std::span{out});
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(out[i].value(), v[i].value()) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+TYPED_TEST(EndianSpanRT, InPlace) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(6);
+  for (auto n: Sizes) {
+    for (std::size_t off: {0u, 1u}) {
+      auto v = Random<I>(n, rng);
+      auto b = Bytes(v, off);
+      auto s = tjg::EndianSpan<T, P::E>{std::span{b}.subspan(off)};
+      s.add(T{3});
+      s.clamp(T{10}, T{100});
+      s.bit_xor(T{0x21});
+      std::size_t blocks = 0;
+      s.for_each_block([&](std::span<I> blk, std::size_t first) {
+        EXPECT_EQ(first, blocks * (s.aligned() ? 0 : s.Block));
+        ++blocks;
+        for (auto& x: blk)
+          x += T{1};
+      });
+      for (auto& x: v) {
+        auto y = std::clamp(static_cast<T>(x.value() + 3), T{10}, T{100});
+        x = I{static_cast<T>((y ^ 0x21) + 1)};
+      }
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(s[i], v[i].value()) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+} // tjg_test
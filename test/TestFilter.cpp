@@ -0,0 +1,163 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestFilter.cpp — runtime tests for the predicate kernels in Filter.hpp
+// Each filter's bitmask is checked against the Int comparison operators, for
+// signed and unsigned types in both byte orders, and select_indices() and
+// compact() are checked against the bitmask.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestFilter.cpp -lgtest -lgtest_main -lpthread
+
+#include "Filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class FilterRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::big>,
+  P<std::int8_t,    endian::little>,
+  P<std::uint16_t,  endian::big>,
+  P<std::int16_t,   endian::big>,
+  P<std::uint32_t,  endian::big>,
+  P<std::uint32_t,  endian::little>,
+  P<std::int32_t,   endian::big>,
+  P<std::uint64_t,  endian::big>,
+  P<std::int64_t,   endian::little>
+>;
+TYPED_TEST_SUITE(FilterRT, Cases);
+
+template <class I>
+static std::vector<I> Column(std::size_t n, std::uint64_t seed) {
+  using T = typename I::value_type;
+  std::mt19937_64 rng(seed);
+  std::vector<I> v(n);
+  for (auto& x: v) // mix small values (for equality hits) and wide ones
+    x = I{static_cast<T>((rng() % 2) ? rng() % 16 : rng())};
+  return v;
+}
+
+template <class Pred>
+static void Check(std::span<const std::uint64_t> bits, std::size_t count,
+                  std::size_t n, Pred pred)
+{
+  std::size_t want = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    bool b = (bits[i / 64] >> (i % 64)) & 1;
+    ASSERT_EQ(b, pred(i)) << "i=" << i;
+    want += b;
+  }
+  if (n % 64) {
+    EXPECT_EQ(bits.back() >> (n % 64), 0u);
+  }
+  EXPECT_EQ(count, want);
+}
+
+TYPED_TEST(FilterRT, MatchesScalar) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  for (std::size_t n : {0u, 1u, 63u, 64u, 65u, 200u, 1000u}) {
+    auto col = Column<I>(n, n);
+    std::span<const I> in{col};
+    std::vector<std::uint64_t> bits((n + 63) / 64);
+    T mid = col.empty() ? T{1} : col[n / 2].value();
+    for (T x : {T{0}, T{3}, T{9}, static_cast<T>(-1), mid}) {
+      Check(bits, tjg::filter_lt(in, x, std::span{bits}), n,
+            [&](std::size_t i) { return col[i] < I{x}; });
+      Check(bits, tjg::filter_le(in, x, std::span{bits}), n,
+            [&](std::size_t i) { return col[i] <= I{x}; });
+      Check(bits, tjg::filter_eq(in, x, std::span{bits}), n,
+            [&](std::size_t i) { return col[i] == I{x}; });
+      Check(bits, tjg::filter_between(in, T{2}, x, std::span{bits}), n,
+            [&](std::size_t i) { return T{2} <= col[i] && col[i] <= x; });
+    }
+  }
+}
+
+TYPED_TEST(FilterRT, Compact) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using J = Int<T, ~P::E>;
+  std::mt19937_64 rng(7);
+  for (std::size_t n : {0u, 1u, 63u, 64u, 65u, 200u, 1000u}) {
+    auto col = Column<I>(n, n);
+    for (unsigned density : {0u, 1u, 8u, 32u, 63u, 64u}) {
+      std::vector<std::uint64_t> bits((n + 63) / 64);
+      for (std::size_t i = 0; i < n; ++i) {
+        if (rng() % 64 < density)
+          bits[i / 64] |= std::uint64_t{1} << (i % 64);
+      }
+      std::vector<T> want;
+      for (std::size_t i = 0; i < n; ++i) {
+        if ((bits[i / 64] >> (i % 64)) & 1)
+          want.push_back(col[i].value());
+      }
+      std::vector<I> same(n);
+      std::vector<J> swapped(n);
+      auto k1 = tjg::compact(std::span<const I>{col},
+                             std::span<const std::uint64_t>{bits},
+                             std::span{same});
+      auto k2 = tjg::compact(std::span<const I>{col},
+                             std::span<const std::uint64_t>{bits},
+                             std::span{swapped});
+      ASSERT_EQ(k1, want.size()) << "n=" << n << " density=" << density;
+      ASSERT_EQ(k2, want.size()) << "n=" << n << " density=" << density;
+      for (std::size_t k = 0; k < want.size(); ++k) {
+        ASSERT_EQ(same[k].value(), want[k]) << "k=" << k;
+        ASSERT_EQ(swapped[k].value(), want[k]) << "k=" << k;
+      }
+    }
+  }
+}
+
+TEST(Filter, CompactExactOutput) {
+  // Output sized to the selection; stray bits past the end are ignored.
+  std::vector<tjg::LilUint32> col;
+  for (std::uint32_t i = 0; i < 1000; ++i)
+    col.emplace_back(i);
+  std::vector<std::uint64_t> bits((col.size() + 63) / 64, ~std::uint64_t{0});
+  std::vector<tjg::BigUint32> out(col.size());
+  ASSERT_EQ(tjg::compact(std::span<const tjg::LilUint32>{col},
+                         std::span<const std::uint64_t>{bits},
+                         std::span{out}), col.size());
+  for (std::uint32_t i = 0; i < 1000; ++i)
+    EXPECT_EQ(out[i].value(), i);
+}
+
+TEST(Filter, SelectIndices) {
+  std::vector<tjg::BigUint32> col;
+  for (std::uint32_t i = 0; i < 300; ++i)
+    col.emplace_back(i % 7);
+  std::vector<std::uint64_t> bits((col.size() + 63) / 64);
+  auto count = tjg::filter_eq(std::span<const tjg::BigUint32>{col}, 3u,
+                              std::span{bits});
+  std::vector<std::uint32_t> idx(count);
+  ASSERT_EQ(tjg::select_indices(bits, idx), count);
+  for (std::size_t k = 0; k < count; ++k)
+    EXPECT_EQ(idx[k], 7 * k + 3);
+}
+
+} // tjg_test
@@ -0,0 +1,71 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestGather.cpp — runtime tests for tjg::gather()
+// Gathers random indices from tables of every width in both byte orders and
+// checks the native results, with and without prefetching.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestGather.cpp -lgtest -lgtest_main -lpthread
+
+#include "Gather.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  using I = Int<T, E_>;
+};
+
+template <class P> class GatherRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,  endian::big>,
+  P<std::int16_t,  endian::little>,
+  P<std::uint32_t, endian::big>,
+  P<std::int32_t,  endian::little>,
+  P<std::uint64_t, endian::big>,
+  P<std::int64_t,  endian::little>
+>;
+TYPED_TEST_SUITE(GatherRT, Cases);
+
+TYPED_TEST(GatherRT, MatchesScalar) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(3);
+  std::vector<I> table(5000);
+  for (auto& x: table)
+    x = I{static_cast<T>(rng())};
+  for (std::size_t n : {0u, 1u, 7u, 8u, 17u, 1000u}) {
+    std::vector<std::uint32_t> idx(n);
+    for (auto& j: idx)
+      j = static_cast<std::uint32_t>(rng() % table.size());
+    if (n != 0) // last row, to catch over-reads
+      idx.back() = static_cast<std::uint32_t>(table.size() - 1);
+    for (std::size_t ahead : {std::size_t{0}, std::size_t{1},
+                              tjg::GatherAhead})
+    {
+      std::vector<T> out(n);
+      tjg::gather(std::span<const I>{table}, idx, std::span{out}, ahead);
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(out[i], table[idx[i]].value()) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+} // tjg_test
@@ -0,0 +1,85 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestHistogram.cpp — runtime tests for the kernels in Histogram.hpp
+// Serial and threaded histograms of 8- and 16-bit columns in both byte orders
+// are checked against a per-element count of the native values.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestHistogram.cpp -lgtest -lgtest_main -lpthread
+
+#include "Histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  using I = Int<T, E_>;
+};
+
+template <class P> class HistogramRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,  endian::big>,
+  P<std::int8_t,   endian::little>,
+  P<std::uint16_t, endian::big>,
+  P<std::uint16_t, endian::little>,
+  P<std::int16_t,  endian::big>
+>;
+TYPED_TEST_SUITE(HistogramRT, Cases);
+
+TYPED_TEST(HistogramRT, MatchesScalar) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using R = std::make_unsigned_t<T>;
+  constexpr auto Bins = tjg::HistogramBins<T>;
+  std::mt19937_64 rng(1);
+  for (std::size_t n : {0u, 1u, 3u, 5u, 1000u, 100'003u}) {
+    std::vector<I> col(n);
+    for (auto& x: col) // skewed, with long runs of one value
+      x = I{static_cast<T>((rng() % 4) ? 80 : rng())};
+    std::vector<std::uint64_t> want(Bins);
+    for (auto x: col)
+      ++want[static_cast<R>(x.value())];
+    std::span<const I> in{col};
+    std::vector<std::uint64_t> counts(Bins, 1);
+    tjg::histogram(in, std::span{counts});
+    for (std::size_t k = 0; k < Bins; ++k)
+      ASSERT_EQ(counts[k], want[k] + 1) << "n=" << n << " k=" << k;
+    for (unsigned threads : {0u, 2u, 3u, 7u}) {
+      std::vector<std::uint64_t> par(Bins);
+      tjg::parallel_histogram(in, std::span{par}, threads);
+      for (std::size_t k = 0; k < Bins; ++k)
+        ASSERT_EQ(par[k], want[k]) << "threads=" << threads << " k=" << k;
+    }
+  }
+}
+
+TEST(Histogram, Ports) {
+  std::vector<tjg::BigUint16> port(1000, tjg::BigUint16{443});
+  for (std::size_t i = 0; i < port.size(); i += 10)
+    port[i] = tjg::BigUint16{80};
+  std::vector<std::uint64_t> counts(tjg::HistogramBins<std::uint16_t>);
+  tjg::histogram(std::span<const tjg::BigUint16>{port}, std::span{counts});
+  EXPECT_EQ(counts[80], 100u);
+  EXPECT_EQ(counts[443], 900u);
+  EXPECT_EQ(counts[std::byteswap(std::uint16_t{443})], 0u);
+}
+
+} // tjg_test
@@ -0,0 +1,95 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestIntBuffer.cpp — runtime tests for IntBuffer<T, E>
+// Buffers are filled, moved and flipped to the other byte order; the flip must
+// keep every value and the memory address, and leave the source empty.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestIntBuffer.cpp -lgtest -lgtest_main -lpthread
+
+#include "IntBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class IntBufferRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::big>,
+  P<std::int16_t,   endian::little>,
+  P<std::uint32_t,  endian::big>,
+  P<std::int32_t,   endian::little>,
+  P<std::uint64_t,  endian::big>,
+  P<std::int64_t,   endian::little>
+>;
+TYPED_TEST_SUITE(IntBufferRT, Cases);
+
+static_assert(!std::is_copy_constructible_v<tjg::IntBuffer<int>>);
+static_assert(std::is_nothrow_move_constructible_v<tjg::IntBuffer<int>>);
+
+TYPED_TEST(IntBufferRT, SwapEndianness) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(8);
+  for (std::size_t n: {0u, 1u, 7u, 64u, 1001u}) {
+    std::vector<I> v(n);
+    for (auto& x: v)
+      x = I{static_cast<T>(rng())};
+    auto a = tjg::IntBuffer<T, P::E>{std::span<const I>{v}};
+    ASSERT_EQ(a.size(), n);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.data()) % a.Alignment, 0u);
+    for (std::size_t i = 0; i < n; ++i)
+      ASSERT_EQ(a[i], v[i]);
+
+    const void* where = a.data();
+    tjg::IntBuffer<T, ~P::E> b = std::move(a).swap_endianness();
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(static_cast<const void*>(b.data()), where);
+    ASSERT_EQ(b.size(), n);
+    for (std::size_t i = 0; i < n; ++i)
+      ASSERT_EQ(b[i].value(), v[i].value()) << "n=" << n << " i=" << i;
+
+    auto c = std::move(b).swap_endianness();
+    std::size_t i = 0;
+    for (auto x: c)
+      ASSERT_EQ(x, v[i++]);
+  }
+}
+
+TEST(IntBuffer, Zeros) {
+  auto a = tjg::IntBuffer<std::uint32_t, endian::big>{100};
+  for (auto x: a)
+    EXPECT_EQ(x.value(), 0u);
+  std::span<tjg::BigUint32> s = a;
+  s[3] = 7u;
+  auto b = std::move(a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b[3].value(), 7u);
+  a = std::move(b);
+  EXPECT_EQ(a.span().size(), 100u);
+}
+
+} // tjg_test
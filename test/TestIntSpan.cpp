@@ -0,0 +1,203 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestIntSpan.cpp — runtime tests for the bulk span operations in IntSpan.hpp
+// Each kernel is checked against a plain per-element loop over Int, for both
+// storage byte orders and for lengths that straddle the SIMD block sizes.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestIntSpan.cpp -lgtest -lgtest_main -lpthread
+
+#include "IntSpan.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+// ---- Test parameter carrier ----
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class IntSpanRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::native>,
+  P<std::int8_t,    endian::native>,
+  P<std::uint16_t,  endian::native>,
+  P<std::int16_t,  ~endian::native>,
+  P<std::uint32_t,  endian::native>,
+  P<std::int32_t,  ~endian::native>,
+  P<std::uint64_t, ~endian::native>,
+  P<std::int64_t,   endian::native>
+>;
+TYPED_TEST_SUITE(IntSpanRT, Cases);
+
+static constexpr std::size_t Sizes[] = {0, 1, 3, 15, 16, 17, 31, 32, 33, 64,
+                                        65, 100, 257};
+
+template <class T>
+static std::vector<T> RandomValues(std::size_t n, std::uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::vector<T> v(n);
+  for (auto& x: v)
+    x = static_cast<T>(rng());
+  return v;
+}
+
+// ---------- fill ----------
+TYPED_TEST(IntSpanRT, Fill) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  for (auto n: Sizes) {
+    std::vector<I> v(n);
+    tjg::fill(std::span{v}, T{0x5a});
+    for (auto& x: v)
+      EXPECT_EQ(x.value(), T{0x5a});
+  }
+}
+
+// ---------- find_not ----------
+TYPED_TEST(IntSpanRT, FindNot) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  for (auto n: Sizes) {
+    for (std::size_t k = 0; k <= n; ++k) {
+      std::vector<I> v(n, I{T{7}});
+      if (k < n)
+        v[k] = I{T{8}};
+      EXPECT_EQ(tjg::find_not(std::span<const I>{v}, I{T{7}}), k)
+          << "n=" << n << " k=" << k;
+    }
+  }
+}
+
+// ---------- min_max ----------
+TYPED_TEST(IntSpanRT, MinMax) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  for (auto n: Sizes) {
+    auto vals = RandomValues<T>(n, n + 1);
+    std::vector<I> v(vals.begin(), vals.end());
+    auto r = tjg::min_max(std::span<const I>{v});
+    if (n == 0) {
+      EXPECT_EQ(r.min, std::numeric_limits<T>::max());
+      EXPECT_EQ(r.max, std::numeric_limits<T>::min());
+      continue;
+    }
+    EXPECT_EQ(r.min, *std::ranges::min_element(vals)) << "n=" << n;
+    EXPECT_EQ(r.max, *std::ranges::max_element(vals)) << "n=" << n;
+  }
+}
+
+// ---------- in-place arithmetic and bitwise ops ----------
+template <class I, class Kernel, class Scalar>
+static void CheckInPlace(Kernel kernel, Scalar scalar) {
+  using T = typename I::value_type;
+  for (auto n: Sizes) {
+    auto vals = RandomValues<T>(n, n + 2);
+    std::vector<I> v(vals.begin(), vals.end());
+    kernel(std::span{v});
+    for (std::size_t i = 0; i < n; ++i) {
+      I want{vals[i]};
+      scalar(want);
+      ASSERT_EQ(v[i].value(), want.value()) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+TYPED_TEST(IntSpanRT, Arithmetic) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using S = std::span<I>;
+  using U = std::make_unsigned_t<T>;
+  const T k = static_cast<T>(0x35);
+  const T lo = static_cast<T>(-3), hi = T{100};
+  const auto [a, b] = std::minmax(lo, hi);
+  CheckInPlace<I>([=](S s) { tjg::add(s, k); },
+                  [=](I& x) { x = static_cast<T>(U(x.value()) + U(k)); });
+  CheckInPlace<I>([=](S s) { tjg::sub(s, k); },
+                  [=](I& x) { x = static_cast<T>(U(x.value()) - U(k)); });
+  // Near 0xFFFF, 16-bit products overflow int unless multiplied unsigned.
+  using M = std::common_type_t<U, unsigned>;
+  for (T m : {k, static_cast<T>(~U{0} - 2)}) {
+    CheckInPlace<I>([=](S s) { tjg::mul(s, m); },
+                    [=](I& x) { x = static_cast<T>(M{U(x.value())} * U(m)); });
+  }
+  for (unsigned sh : {0u, 1u, 5u, unsigned{8 * sizeof(T) - 1}}) {
+    CheckInPlace<I>([=](S s) { tjg::shift_left(s, sh); },
+                    [=](I& x) { x <<= sh; });
+    CheckInPlace<I>([=](S s) { tjg::shift_right(s, sh); },
+                    [=](I& x) { x >>= sh; });
+  }
+  CheckInPlace<I>([=](S s) { tjg::clamp(s, a, b); },
+                  [=](I& x) { x = std::clamp(x.value(), a, b); });
+}
+
+TYPED_TEST(IntSpanRT, Bitwise) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using S = std::span<I>;
+  const T k = static_cast<T>(0x0ff1);
+  CheckInPlace<I>([=](S s) { tjg::bit_and(s, k); },
+                  [=](I& x) { x &= I{k}; });
+  CheckInPlace<I>([=](S s) { tjg::bit_or(s, k); },
+                  [=](I& x) { x |= I{k}; });
+  CheckInPlace<I>([=](S s) { tjg::bit_xor(s, k); },
+                  [=](I& x) { x ^= I{k}; });
+}
+
+// ---------- transform_native ----------
+TYPED_TEST(IntSpanRT, TransformNative) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using U = std::make_unsigned_t<T>;
+  auto f = [](T x) { return static_cast<T>(U(x) * 3u + (U(x) >> 2)); };
+  CheckInPlace<I>([=](std::span<I> s) {
+                    tjg::transform_native(s, [=](std::span<T> b) {
+                      for (auto& x: b)
+                        x = f(x);
+                    });
+                  },
+                  [=](I& x) { x = f(x.value()); });
+  // Blocks: each sees the next elements, in order.
+  const std::size_t n = 3 * tjg::NativeBlockBytes / sizeof(T) + 5;
+  std::vector<I> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = static_cast<T>(i);
+  std::size_t next = 0;
+  tjg::transform_native(std::span{v}, [&](std::span<T> b) {
+    for (auto& x: b) {
+      ASSERT_EQ(x, static_cast<T>(next++));
+      x = static_cast<T>(~x);
+    }
+  });
+  ASSERT_EQ(next, n);
+  for (std::size_t i = 0; i < n; ++i)
+    ASSERT_EQ(v[i].value(), static_cast<T>(~static_cast<T>(i))) << i;
+}
+
+} // tjg_test
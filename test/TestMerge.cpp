@@ -0,0 +1,87 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestMerge.cpp — runtime tests for tjg::KWayMerge<T, E> and tjg::merge()
+// Merges random sorted runs (including empty and single runs, and runs longer
+// than a decode block) and checks the result against std::ranges::sort, read
+// in one call and in small batches, in both output byte orders.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestMerge.cpp -lgtest -lgtest_main -lpthread
+
+#include "Merge.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class MergeRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint64_t, endian::big>,
+  P<std::int64_t,  endian::little>,
+  P<std::uint32_t, endian::big>,
+  P<std::int16_t,  endian::big>
+>;
+TYPED_TEST_SUITE(MergeRT, Cases);
+
+TYPED_TEST(MergeRT, MatchesSort) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using J = Int<T, ~P::E>;
+  std::mt19937_64 rng(5);
+  for (std::size_t k : {0u, 1u, 2u, 3u, 7u, 16u, 33u}) {
+    std::vector<std::vector<I>> data(k);
+    std::vector<T> want;
+    for (auto& run: data) {
+      std::vector<T> v(rng() % 700);
+      for (auto& x: v) // narrow range for many equal keys
+        x = static_cast<T>(rng() % 1000);
+      std::ranges::sort(v);
+      want.insert(want.end(), v.begin(), v.end());
+      run.assign(v.begin(), v.end());
+    }
+    std::ranges::sort(want);
+    std::vector<std::span<const I>> runs(data.begin(), data.end());
+
+    std::vector<J> out(want.size());
+    ASSERT_EQ(tjg::merge(std::span<const std::span<const I>>{runs},
+                         std::span{out}), want.size());
+    for (std::size_t i = 0; i < want.size(); ++i)
+      ASSERT_EQ(out[i].value(), want[i]) << "k=" << k << " i=" << i;
+
+    tjg::KWayMerge<T, P::E> m{runs};
+    EXPECT_EQ(m.size(), want.size());
+    std::vector<I> got;
+    std::vector<I> batch(37);
+    while (auto n = m.read(std::span{batch}))
+      got.insert(got.end(), batch.begin(),
+                 batch.begin() + static_cast<std::ptrdiff_t>(n));
+    EXPECT_TRUE(m.empty());
+    ASSERT_EQ(got.size(), want.size());
+    for (std::size_t i = 0; i < want.size(); ++i)
+      ASSERT_EQ(got[i].value(), want[i]) << "k=" << k << " i=" << i;
+  }
+}
+
+} // tjg_test
@@ -0,0 +1,161 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestRankSelect.cpp — runtime tests for tjg::RankSelect<E>
+// Checks rank/select against a naive scan for both storage byte orders, that
+// an image written in one byte order is readable after a raw copy, and that
+// truncated or corrupt images are rejected.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestRankSelect.cpp -lgtest -lgtest_main -lpthread
+
+#include "RankSelect.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::RankSelect;
+
+template <endian E_>
+struct P { static constexpr endian E = E_; };
+
+template <class P> class RankSelectRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<P<endian::native>, P<~endian::native>>;
+TYPED_TEST_SUITE(RankSelectRT, Cases);
+
+static std::vector<std::uint64_t> RandomBits(std::size_t nbits, unsigned pct,
+                                             std::uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+  std::vector<std::uint64_t> bits((nbits + 63) / 64);
+  for (std::size_t i = 0; i < nbits; ++i)
+    if (rng() % 100 < pct)
+      bits[i / 64] |= std::uint64_t{1} << (i % 64);
+  return bits;
+}
+
+static bool Bit(const std::vector<std::uint64_t>& bits, std::size_t i)
+  { return (bits[i / 64] >> (i % 64)) & 1; }
+
+// ---------- select64 ----------
+TEST(Select64, MatchesNaive) {
+  std::mt19937_64 rng(0x5E1EC7);
+  for (int n = 0; n < 1000; ++n) {
+    auto x = rng() & rng();
+    unsigned r = 0;
+    for (unsigned i = 0; i < 64; ++i) {
+      if ((x >> i) & 1) {
+        EXPECT_EQ(tjg::select64(x, r), i);
+        ++r;
+      }
+    }
+    EXPECT_EQ(tjg::select64(x, r), 64u);
+  }
+  static_assert(tjg::select64(0b1011'0000, 2) == 7);
+}
+
+// ---------- rank/select vs naive ----------
+TYPED_TEST(RankSelectRT, MatchesNaive) {
+  constexpr auto E = TypeParam::E;
+  for (std::size_t nbits : {0u, 1u, 63u, 64u, 511u, 512u, 513u, 5000u,
+                            70'000u})
+  {
+    for (unsigned pct : {0u, 3u, 50u, 97u, 100u}) {
+      auto bits  = RandomBits(nbits, pct, nbits * 131 + pct);
+      auto image = RankSelect<E>::encode(bits, nbits);
+      ASSERT_EQ(image.size(), RankSelect<E>::image_size(nbits));
+      RankSelect<E> rs{image};
+      ASSERT_EQ(rs.size(), nbits);
+
+      std::size_t ones = 0;
+      for (std::size_t i = 0; i < nbits; ++i) {
+        ASSERT_EQ(rs.rank1(i), ones) << "nbits=" << nbits << " i=" << i;
+        ASSERT_EQ(rs.rank0(i), i - ones);
+        ASSERT_EQ(rs[i], Bit(bits, i));
+        if (Bit(bits, i)) {
+          ASSERT_EQ(rs.select1(ones), i);
+          ++ones;
+        } else {
+          ASSERT_EQ(rs.select0(i - ones), i);
+        }
+      }
+      EXPECT_EQ(rs.count(), ones);
+      EXPECT_EQ(rs.rank1(nbits), ones);
+      EXPECT_EQ(rs.select1(ones), nbits);
+      EXPECT_EQ(rs.select0(nbits - ones), nbits);
+    }
+  }
+}
+
+// ---------- Trailing bits beyond size are ignored ----------
+TYPED_TEST(RankSelectRT, TrailingBitsMasked) {
+  constexpr auto E = TypeParam::E;
+  std::vector<std::uint64_t> bits{~std::uint64_t{0}};
+  auto image = RankSelect<E>::encode(bits, 10);
+  RankSelect<E> rs{image};
+  EXPECT_EQ(rs.count(), 10u);
+  EXPECT_EQ(rs.rank1(10), 10u);
+  EXPECT_EQ(rs.select0(0), 10u);
+}
+
+// ---------- Truncated or corrupt images are rejected ----------
+TYPED_TEST(RankSelectRT, RejectsBadImage) {
+  constexpr auto E = TypeParam::E;
+  using Word = typename RankSelect<E>::Word;
+  auto image = RankSelect<E>::encode(RandomBits(3000, 40, 78), 3000);
+  auto s = std::span<const Word>{image};
+  for (std::size_t n : {std::size_t{0}, std::size_t{1},
+                        RankSelect<E>::HeaderWords, image.size() - 1})
+  {
+    EXPECT_THROW(RankSelect<E>{s.first(n)}, std::invalid_argument)
+        << "n=" << n;
+  }
+  EXPECT_NO_THROW(RankSelect<E>{s});
+  image[1] = std::uint64_t{3001}; // more ones than bits
+  EXPECT_THROW(RankSelect<E>{s}, std::invalid_argument);
+  image[1] = std::uint64_t{0};
+  image[0] = ~std::uint64_t{0};
+  EXPECT_THROW(RankSelect<E>{s}, std::invalid_argument);
+}
+
+// ---------- Image bytes are portable ----------
+TYPED_TEST(RankSelectRT, RawImageCopy) {
+  constexpr auto E = TypeParam::E;
+  using Word = typename RankSelect<E>::Word;
+  auto bits  = RandomBits(3000, 40, 77);
+  auto image = RankSelect<E>::encode(bits, 3000);
+
+  // Simulate writing the image to a file and mapping it back.
+  std::vector<std::byte> file(image.size() * sizeof(Word));
+  std::memcpy(file.data(), image.data(), file.size());
+  std::vector<Word> mapped(image.size());
+  std::memcpy(mapped.data(), file.data(), file.size());
+
+  RankSelect<E> a{image};
+  RankSelect<E> b{mapped};
+  for (std::size_t i = 0; i <= 3000; i += 7)
+    EXPECT_EQ(a.rank1(i), b.rank1(i));
+
+  if constexpr (E == endian::big) {
+    // First header word is the bit count, most significant byte first.
+    EXPECT_EQ(file[7], std::byte{3000 & 0xff});
+    EXPECT_EQ(file[6], std::byte{3000 >> 8});
+  } else {
+    EXPECT_EQ(file[0], std::byte{3000 & 0xff});
+    EXPECT_EQ(file[1], std::byte{3000 >> 8});
+  }
+}
+
+} // tjg_test
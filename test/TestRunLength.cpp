@@ -0,0 +1,132 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestRunLength.cpp — runtime tests for tjg::RunLength<T, E>
+// Round trips columns with long and short runs through encode/decode in both
+// byte orders, and checks the per-run predicate helpers against a naive scan.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestRunLength.cpp -lgtest -lgtest_main -lpthread
+
+#include "RunLength.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+using tjg::RunLength;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class RunLengthRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::big>,
+  P<std::uint16_t,  endian::big>,
+  P<std::uint16_t,  endian::little>,
+  P<std::int32_t,   endian::big>,
+  P<std::uint64_t,  endian::little>
+>;
+TYPED_TEST_SUITE(RunLengthRT, Cases);
+
+template <class I>
+static std::vector<I> RunnyColumn(std::size_t n, std::uint64_t seed) {
+  using T = typename I::value_type;
+  std::mt19937_64 rng(seed);
+  std::vector<I> v;
+  while (v.size() < n) {
+    auto len = std::size_t{1} + rng() % ((rng() % 4 == 0) ? 200 : 3);
+    auto x = I{static_cast<T>(rng() % 5)};
+    for (std::size_t k = 0; k < len && v.size() < n; ++k)
+      v.push_back(x);
+  }
+  return v;
+}
+
+TYPED_TEST(RunLengthRT, RoundTrip) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using RL = RunLength<T, ~P::E>; // encode into the other byte order
+
+  for (std::size_t n : {0u, 1u, 2u, 50u, 1000u, 10000u}) {
+    auto col = RunnyColumn<I>(n, n);
+    auto nruns = RL::count_runs(std::span<const I>{col});
+    std::vector<typename RL::Value> values(nruns);
+    std::vector<typename RL::End>   ends(nruns);
+    ASSERT_EQ(RL::encode(std::span<const I>{col}, std::span{values},
+                         std::span{ends}), nruns);
+    RL rl{values, ends};
+    ASSERT_EQ(rl.size(), n);
+    ASSERT_EQ(rl.runs(), nruns);
+
+    for (std::size_t r = 1; r < nruns; ++r)
+      EXPECT_NE(values[r], values[r - 1]);
+
+    for (std::size_t i = 0; i < n; ++i)
+      ASSERT_EQ(rl[i], col[i].value());
+
+    std::vector<I> out(n);
+    rl.decode(std::span{out});
+    EXPECT_EQ(out, col);
+  }
+}
+
+TYPED_TEST(RunLengthRT, Predicates) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using RL = RunLength<T, P::E>;
+
+  auto col = RunnyColumn<I>(5000, 99);
+  std::vector<typename RL::Value> values(col.size());
+  std::vector<typename RL::End>   ends(col.size());
+  auto nruns = RL::encode(std::span<const I>{col}, std::span{values},
+                          std::span{ends});
+  RL rl{std::span{values}.first(nruns), std::span{ends}.first(nruns)};
+
+  auto pred = [](T x) { return x == T{1} || x == T{2}; };
+  std::size_t want = 0;
+  for (auto x: col)
+    want += pred(x.value());
+  EXPECT_EQ(rl.count_if(pred), want);
+
+  std::vector<std::uint64_t> bits((col.size() + 63) / 64);
+  rl.select(pred, bits);
+  for (std::size_t i = 0; i < col.size(); ++i)
+    ASSERT_EQ(((bits[i / 64] >> (i % 64)) & 1) != 0, pred(col[i].value()));
+
+  std::size_t prevLast = 0;
+  std::size_t total = 0;
+  rl.for_each_if(pred, [&](std::size_t first, std::size_t last) {
+    EXPECT_LT(first, last);
+    if (total != 0) {
+      EXPECT_LT(prevLast, first); // ranges are maximal, so never adjacent
+    }
+    prevLast = last;
+    total += last - first;
+  });
+  EXPECT_EQ(total, want);
+
+  std::size_t calls = 0;
+  rl.for_each_if([&](T x) { ++calls; return pred(x); },
+                 [](std::size_t, std::size_t) { });
+  EXPECT_EQ(calls, rl.runs()); // once per run
+}
+
+} // tjg_test
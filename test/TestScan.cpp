@@ -0,0 +1,111 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestScan.cpp — runtime tests for the prefix-sum kernels in Scan.hpp
+// Inclusive and exclusive scans, serial and threaded, are checked against a
+// scalar running total for widening and same-width conversions between byte
+// orders.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestScan.cpp -lgtest -lgtest_main -lpthread
+
+#include "Scan.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E1_, class U_, endian E2_>
+struct P {
+  using T = T_;
+  using U = U_;
+  using I = Int<T, E1_>;
+  using O = Int<U, E2_>;
+};
+
+template <class P> class ScanRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint32_t, endian::big,    std::uint64_t, endian::native>,
+  P<std::uint32_t, endian::big,    std::uint32_t, endian::little>,
+  P<std::uint8_t,  endian::big,    std::uint32_t, endian::big>,
+  P<std::uint16_t, endian::big,    std::uint64_t, endian::little>,
+  P<std::int16_t,  endian::little, std::int32_t,  endian::big>,
+  P<std::int32_t,  endian::big,    std::int64_t,  endian::little>,
+  P<std::uint64_t, endian::little, std::uint64_t, endian::big>
+>;
+TYPED_TEST_SUITE(ScanRT, Cases);
+
+template <class I>
+static std::vector<I> Column(std::size_t n) {
+  using T = typename I::value_type;
+  std::mt19937_64 rng(n);
+  std::vector<I> v(n);
+  for (auto& x: v)
+    x = I{static_cast<T>(rng())};
+  return v;
+}
+
+TYPED_TEST(ScanRT, MatchesScalar) {
+  using P = TypeParam;
+  using U = P::U;
+  using I = P::I;
+  using O = P::O;
+  using W = std::make_unsigned_t<U>;
+  for (std::size_t n : {0u, 1u, 3u, 4u, 7u, 33u, 64u, 1000u, 4099u}) {
+    auto col = Column<I>(n);
+    std::span<const I> in{col};
+    std::vector<W> incl(n), excl(n);
+    W acc = 5;
+    for (std::size_t i = 0; i < n; ++i) {
+      excl[i] = acc;
+      acc += static_cast<W>(col[i].value());
+      incl[i] = acc;
+    }
+    auto check = [&](const std::vector<O>& out, const std::vector<W>& want,
+                     U total, const char* what)
+    {
+      EXPECT_EQ(static_cast<W>(total), acc) << what << " n=" << n;
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(static_cast<W>(out[i].value()), want[i])
+            << what << " n=" << n << " i=" << i;
+    };
+    std::vector<O> out(n);
+    check(out, excl, tjg::exclusive_scan(in, std::span{out}, 5), "excl");
+    check(out, incl, tjg::inclusive_scan(in, std::span{out}, 5), "incl");
+    for (unsigned threads : {0u, 2u, 3u, 8u}) {
+      check(out, excl,
+            tjg::parallel_exclusive_scan(in, std::span{out}, 5, threads),
+            "parallel excl");
+      check(out, incl,
+            tjg::parallel_inclusive_scan(in, std::span{out}, 5, threads),
+            "parallel incl");
+    }
+  }
+}
+
+TEST(Scan, LengthsToOffsets) {
+  std::vector<tjg::BigUint32> len;
+  for (std::uint32_t i = 0; i < 100; ++i)
+    len.emplace_back(i);
+  std::vector<Int<std::uint64_t>> off(len.size());
+  auto end = tjg::exclusive_scan(std::span<const tjg::BigUint32>{len},
+                                 std::span{off});
+  EXPECT_EQ(end, 4950u);
+  for (std::uint64_t i = 0; i < off.size(); ++i)
+    EXPECT_EQ(off[i].value(), i * (i - 1) / 2);
+}
+
+} // tjg_test
@@ -0,0 +1,127 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestSetOps.cpp — runtime tests for set_intersection() and set_union()
+// Random sorted sets of several densities and size ratios (including ones that
+// gallop) are combined and checked against std::set_intersection and
+// std::set_union, with output in both byte orders.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestSetOps.cpp -lgtest -lgtest_main -lpthread
+
+#include "SetOps.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class SetOpsRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,  endian::big>,
+  P<std::uint16_t, endian::big>,
+  P<std::int16_t,  endian::little>,
+  P<std::uint32_t, endian::big>,
+  P<std::int32_t,  endian::little>,
+  P<std::uint64_t, endian::big>,
+  P<std::int64_t,  endian::little>
+>;
+TYPED_TEST_SUITE(SetOpsRT, Cases);
+
+// n distinct sorted values, each kept with probability 1/stride from a range
+// starting at -n for signed types.
+template <class T>
+static std::vector<T> SortedSet(std::size_t n, std::size_t stride,
+                                std::mt19937_64& rng)
+{
+  std::vector<T> v;
+  T x = std::is_signed_v<T> ? static_cast<T>(-static_cast<long long>(n)) : 0;
+  while (v.size() < n && x < std::numeric_limits<T>::max()) {
+    if (rng() % stride == 0)
+      v.push_back(x);
+    ++x;
+  }
+  return v;
+}
+
+template <class I, class T>
+static std::vector<I> ToInt(const std::vector<T>& v)
+  { return std::vector<I>(v.begin(), v.end()); }
+
+TYPED_TEST(SetOpsRT, MatchesStd) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using J = Int<T, ~P::E>;
+  std::mt19937_64 rng(11);
+  struct Shape { std::size_t na, sa, nb, sb; };
+  for (auto [na, sa, nb, sb] : {Shape{0, 1, 10, 1}, Shape{1, 1, 1, 1},
+                                Shape{50, 2, 60, 2}, Shape{100, 1, 100, 1},
+                                Shape{200, 3, 150, 2}, Shape{5, 1, 1000, 1},
+                                Shape{1000, 4, 7, 50}, Shape{120, 9, 250, 1}})
+  {
+    auto av = SortedSet<T>(na, sa, rng);
+    auto bv = SortedSet<T>(nb, sb, rng);
+    std::vector<T> inter, uni;
+    std::ranges::set_intersection(av, bv, std::back_inserter(inter));
+    std::ranges::set_union(av, bv, std::back_inserter(uni));
+    auto a = ToInt<I>(av);
+    auto b = ToInt<I>(bv);
+    std::span<const I> sa_{a}, sb_{b};
+    std::vector<J> out(a.size() + b.size());
+    std::vector<I> same(a.size() + b.size());
+
+    ASSERT_EQ(tjg::set_intersection(sa_, sb_, std::span{out}), inter.size());
+    for (std::size_t k = 0; k < inter.size(); ++k)
+      ASSERT_EQ(out[k].value(), inter[k]) << "na=" << na << " k=" << k;
+    ASSERT_EQ(tjg::set_intersection(sb_, sa_, std::span{same}), inter.size());
+    for (std::size_t k = 0; k < inter.size(); ++k)
+      ASSERT_EQ(same[k].value(), inter[k]) << "na=" << na << " k=" << k;
+
+    ASSERT_EQ(tjg::set_union(sa_, sb_, std::span{out}), uni.size());
+    for (std::size_t k = 0; k < uni.size(); ++k)
+      ASSERT_EQ(out[k].value(), uni[k]) << "na=" << na << " k=" << k;
+    ASSERT_EQ(tjg::set_union(sb_, sa_, std::span{same}), uni.size());
+    for (std::size_t k = 0; k < uni.size(); ++k)
+      ASSERT_EQ(same[k].value(), uni[k]) << "na=" << na << " k=" << k;
+  }
+}
+
+TEST(SetOps, PostingLists) {
+  std::vector<tjg::BigUint32> a, b;
+  for (std::uint32_t i = 0; i < 1000; ++i) {
+    a.emplace_back(3 * i);
+    b.emplace_back(5 * i);
+  }
+  std::vector<tjg::LilUint32> out(a.size() + b.size());
+  auto n = tjg::set_intersection(std::span<const tjg::BigUint32>{a},
+                                 std::span<const tjg::BigUint32>{b},
+                                 std::span{out});
+  ASSERT_EQ(n, 200u);
+  for (std::uint32_t k = 0; k < n; ++k)
+    EXPECT_EQ(out[k].value(), 15 * k);
+}
+
+} // tjg_test
@@ -0,0 +1,96 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestSimd.cpp — runtime tests for simd_load() and simd_store()
+// Int arrays of both byte orders are loaded into std::experimental::simd with
+// the native and a fixed-size ABI, checked lane by lane, stored back in the
+// other byte order, and summed by a hand-written simd loop.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestSimd.cpp -lgtest -lgtest_main -lpthread
+
+#include "Simd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace tjg_test {
+
+namespace stdx = std::experimental;
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class SimdRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,   endian::big>,
+  P<std::int16_t,   endian::little>,
+  P<std::uint16_t,  endian::big>,
+  P<std::uint32_t,  endian::big>,
+  P<std::int32_t,   endian::little>,
+  P<std::uint64_t,  endian::big>,
+  P<std::int64_t,   endian::little>
+>;
+TYPED_TEST_SUITE(SimdRT, Cases);
+
+template <class I, class S>
+static void CheckLoadStore(const std::vector<I>& v) {
+  using T = typename I::value_type;
+  using J = Int<T, ~I::Endian>;
+  std::vector<J> out(v.size());
+  for (std::size_t i = 0; i + S::size() <= v.size(); i += S::size()) {
+    S x = tjg::simd_load<typename S::abi_type>(v.data() + i);
+    for (std::size_t k = 0; k < S::size(); ++k)
+      ASSERT_EQ(T{x[k]}, v[i + k].value()) << "i=" << i << " k=" << k;
+    tjg::simd_store(out.data() + i, x);
+    for (std::size_t k = 0; k < S::size(); ++k)
+      ASSERT_EQ(out[i + k].value(), v[i + k].value());
+  }
+}
+
+TYPED_TEST(SimdRT, LoadStore) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(4);
+  std::vector<I> v(256);
+  for (auto& x: v)
+    x = I{static_cast<T>(rng())};
+  CheckLoadStore<I, stdx::native_simd<T>>(v);
+  CheckLoadStore<I, stdx::fixed_size_simd<T, 8>>(v);
+  CheckLoadStore<I, stdx::fixed_size_simd<T, 3>>(v);
+  static_assert(std::is_same_v<decltype(tjg::simd_load(v.data())),
+                               stdx::native_simd<T>>);
+}
+
+TEST(Simd, SumBigEndian) {
+  std::vector<tjg::BigUint32> v(1000);
+  std::uint32_t want = 0;
+  for (std::uint32_t i = 0; i < v.size(); ++i) {
+    v[i] = i * 2654435761u;
+    want += i * 2654435761u;
+  }
+  stdx::native_simd<std::uint32_t> sum = 0;
+  std::size_t i = 0;
+  for (; i + sum.size() <= v.size(); i += sum.size())
+    sum += tjg::simd_load(v.data() + i);
+  auto got = stdx::reduce(sum);
+  for (; i < v.size(); ++i)
+    got += v[i].value();
+  EXPECT_EQ(got, want);
+}
+
+} // tjg_test
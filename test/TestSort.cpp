@@ -0,0 +1,135 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestSort.cpp — runtime tests for tjg::parallel_sort()
+// Sorts random keys of every width and both byte orders, uniform, small,
+// skewed and constant, with and without a payload, on one and several
+// threads, and checks the result against std::ranges::stable_sort;
+// sort_by_field() is checked the same way on records keyed by BigUint32 and
+// BigInt64 members.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestSort.cpp -lgtest -lgtest_main -lpthread
+
+#include "Sort.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class SortRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,  endian::big>,
+  P<std::int8_t,   endian::little>,
+  P<std::uint16_t, endian::little>,
+  P<std::int16_t,  endian::big>,
+  P<std::uint32_t, endian::big>,
+  P<std::int32_t,  endian::little>,
+  P<std::uint64_t, endian::big>,
+  P<std::int64_t,  endian::big>,
+  P<std::int64_t,  endian::little>
+>;
+TYPED_TEST_SUITE(SortRT, Cases);
+
+TYPED_TEST(SortRT, MatchesStableSort) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  std::mt19937_64 rng(9);
+  for (std::size_t n : {0u, 1u, 2u, 31u, 33u, 500u, 20'000u}) {
+    // Uniform; narrow (duplicates, equal top bytes); skewed (mostly narrow,
+    // so one bucket outgrows a thread's share); and all equal.
+    for (int dist : {0, 1, 2, 3}) {
+      auto key = [&]() -> T {
+        switch (dist) {
+        case 0:  return static_cast<T>(rng());
+        case 1:  return static_cast<T>(rng() % 300);
+        case 2:  return static_cast<T>((rng() % 10 != 0) ? rng() % 300 : rng());
+        default: return T{42};
+        }
+      };
+      std::vector<std::pair<T, std::size_t>> want(n);
+      for (std::size_t i = 0; i < n; ++i)
+        want[i] = {key(), i};
+      std::vector<I> keys;
+      for (auto& [k, i]: want)
+        keys.emplace_back(k);
+      std::ranges::stable_sort(want, {}, &std::pair<T, std::size_t>::first);
+      for (unsigned threads : {1u, 3u, 8u}) {
+        auto k1 = keys;
+        tjg::parallel_sort(std::span{k1}, threads);
+        auto k2 = keys;
+        std::vector<std::string> pay(n);
+        for (std::size_t i = 0; i < n; ++i)
+          pay[i] = std::to_string(i);
+        tjg::parallel_sort(std::span{k2}, std::span{pay}, threads);
+        for (std::size_t i = 0; i < n; ++i) {
+          ASSERT_EQ(k1[i].value(), want[i].first)
+              << "n=" << n << " dist=" << dist << " threads=" << threads
+              << " i=" << i;
+          ASSERT_EQ(k2[i].value(), want[i].first) << "i=" << i;
+          ASSERT_EQ(pay[i], std::to_string(want[i].second)) << "i=" << i;
+        }
+      }
+    }
+  }
+}
+
+struct Record {
+  std::uint16_t   tag;
+  tjg::BigUint32  id;
+  tjg::BigInt64   score;
+  std::uint32_t   row;
+};
+
+template <auto Field>
+static void CheckSortByField() {
+  std::mt19937_64 rng(12);
+  for (std::size_t n : {0u, 1u, 40u, 3000u}) {
+    std::vector<Record> recs(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      recs[i] = Record{static_cast<std::uint16_t>(rng()),
+                       tjg::BigUint32{static_cast<std::uint32_t>(rng() % 500)},
+                       tjg::BigInt64{static_cast<std::int64_t>(rng())},
+                       static_cast<std::uint32_t>(i)};
+    }
+    auto want = recs;
+    std::ranges::stable_sort(want, {}, [](const Record& r)
+                                         { return (r.*Field).value(); });
+    for (unsigned threads : {1u, 4u}) {
+      auto got = recs;
+      tjg::sort_by_field<Field>(std::span{got}, threads);
+      for (std::size_t i = 0; i < n; ++i)
+        ASSERT_EQ(got[i].row, want[i].row) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+TEST(Sort, ByField) {
+  CheckSortByField<&Record::id>();
+  CheckSortByField<&Record::score>();
+}
+
+} // tjg_test
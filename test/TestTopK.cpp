@@ -0,0 +1,79 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestTopK.cpp — runtime tests for tjg::top_k()
+// Random, ascending (worst case for the threshold) and duplicate-heavy
+// columns of several types are checked against a stable sort by value.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestTopK.cpp -lgtest -lgtest_main -lpthread
+
+#include "TopK.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class TopKRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::uint8_t,  endian::big>,
+  P<std::int16_t,  endian::little>,
+  P<std::uint32_t, endian::big>,
+  P<std::int32_t,  endian::big>,
+  P<std::uint64_t, endian::big>,
+  P<std::int64_t,  endian::little>
+>;
+TYPED_TEST_SUITE(TopKRT, Cases);
+
+TYPED_TEST(TopKRT, MatchesSort) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using R = tjg::Ranked<T>;
+  std::mt19937_64 rng(4);
+  for (std::size_t n : {0u, 1u, 10u, 100u, 5000u}) {
+    for (int shape = 0; shape != 3; ++shape) {
+      std::vector<I> col(n);
+      std::vector<R> want(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        T x = (shape == 0) ? static_cast<T>(rng())
+            : (shape == 1) ? static_cast<T>(i)
+            :                static_cast<T>(rng() % 5);
+        col[i] = I{x};
+        want[i] = R{x, i};
+      }
+      std::ranges::stable_sort(want, [](const R& a, const R& b)
+                                       { return a.value > b.value; });
+      for (std::size_t k : {0u, 1u, 7u, 64u, 10'000u}) {
+        auto got = tjg::top_k(std::span<const I>{col}, k);
+        auto m = std::min(k, n);
+        ASSERT_EQ(got.size(), m);
+        for (std::size_t j = 0; j < m; ++j)
+          ASSERT_EQ(got[j], want[j])
+              << "n=" << n << " shape=" << shape << " k=" << k << " j=" << j;
+      }
+    }
+  }
+}
+
+} // tjg_test
@@ -0,0 +1,145 @@
+/// @file
+/// @copyright 2025 Terry Golubiewski, all rights reserved.
+/// @author Terry Golubiewski
+
+// TestZoneMap.cpp — runtime tests for tjg::ZoneMap<T, E>
+// Builds zone statistics with and without a validity bitmask and checks that
+// candidate ranges cover every matching row and skip zones that cannot match.
+//
+// Build: link with GoogleTest and pthread.
+//  g++ -std=c++23 -O2 -I.. TestZoneMap.cpp -lgtest -lgtest_main -lpthread
+
+#include "ZoneMap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace tjg_test {
+
+using std::endian;
+using tjg::Int;
+using tjg::ZoneMap;
+
+template <class T_, endian E_>
+struct P {
+  using T = T_;
+  static constexpr endian E = E_;
+  using I = Int<T, E>;
+};
+
+template <class P> class ZoneMapRT : public ::testing::Test {};
+
+using Cases = ::testing::Types<
+  P<std::int64_t,  endian::big>,
+  P<std::int64_t,  endian::little>,
+  P<std::uint32_t, endian::big>,
+  P<std::int16_t,  endian::big>
+>;
+TYPED_TEST_SUITE(ZoneMapRT, Cases);
+
+// Mostly increasing column, like a timestamp, with some noise.
+template <class I>
+static std::vector<I> Column(std::size_t n) {
+  using T = typename I::value_type;
+  std::mt19937_64 rng(n);
+  std::vector<I> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = I{static_cast<T>(static_cast<T>(i / 4) + static_cast<T>(rng() % 8))};
+  return v;
+}
+
+TYPED_TEST(ZoneMapRT, StatsAndCandidates) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using ZM = ZoneMap<T, endian::big>;
+
+  constexpr std::size_t N = 5000;
+  constexpr std::size_t Block = 256;
+  auto col = Column<I>(N);
+  auto nz = ZM::zones(N, Block);
+  ASSERT_EQ(nz, 20u);
+
+  std::vector<typename ZM::Value> mins(nz), maxs(nz);
+  std::vector<typename ZM::Count> nulls(nz);
+  ZM::build(std::span<const I>{col}, Block, std::span{mins}, std::span{maxs},
+            std::span{nulls});
+  ZM zm{N, Block, mins, maxs, nulls};
+
+  for (std::size_t z = 0; z < nz; ++z) {
+    auto r = zm.zone_rows(z);
+    auto [lo, hi] = std::ranges::minmax(std::span{col}.subspan(r.first,
+                                                   r.last - r.first));
+    EXPECT_EQ(zm.min(z), lo.value());
+    EXPECT_EQ(zm.max(z), hi.value());
+    EXPECT_EQ(zm.nulls(z), 0u);
+  }
+  EXPECT_EQ(zm.zone_rows(nz - 1).last, N);
+
+  for (auto [lo, hi] : {std::pair<T, T>{100, 120}, {0, 5}, {1000, 1300},
+                        {50, 50}, {2000, 3000}}) {
+    auto ranges = zm.candidates(lo, hi);
+    std::vector<bool> covered(N);
+    std::size_t rows = 0;
+    for (auto r: ranges) {
+      rows += r.last - r.first;
+      for (auto i = r.first; i < r.last; ++i)
+        covered[i] = true;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+      auto x = col[i].value();
+      if (lo <= x && x < hi) {
+        ASSERT_TRUE(covered[i]) << "row " << i << " missed";
+      }
+    }
+    if (lo >= hi || lo >= static_cast<T>(1260)) {
+      EXPECT_TRUE(ranges.empty());
+    } else {
+      EXPECT_LT(rows, N / 2); // most zones are skipped
+    }
+  }
+}
+
+TYPED_TEST(ZoneMapRT, Nulls) {
+  using P = TypeParam;
+  using T = P::T;
+  using I = P::I;
+  using ZM = ZoneMap<T, P::E>;
+
+  constexpr std::size_t N = 1000;
+  constexpr std::size_t Block = 100;
+  auto col = Column<I>(N);
+  std::vector<std::uint64_t> valid((N + 63) / 64, ~std::uint64_t{0});
+  auto setNull = [&](std::size_t i) {
+    valid[i / 64] &= ~(std::uint64_t{1} << (i % 64));
+    col[i] = I{T{100}}; // garbage that must not reach the statistics
+  };
+  for (std::size_t i = 200; i < 300; ++i) // zone 2 all null
+    setNull(i);
+  setNull(0);                             // zone 0 partly null
+  setNull(99);
+
+  auto nz = ZM::zones(N, Block);
+  std::vector<typename ZM::Value> mins(nz), maxs(nz);
+  std::vector<typename ZM::Count> nulls(nz);
+  ZM::build(std::span<const I>{col}, Block, std::span{mins}, std::span{maxs},
+            std::span{nulls}, valid);
+  ZM zm{N, Block, mins, maxs, nulls};
+
+  EXPECT_EQ(zm.nulls(0), 2u);
+  EXPECT_EQ(zm.nulls(1), 0u);
+  EXPECT_EQ(zm.nulls(2), 100u);
+  EXPECT_LT(zm.max(0), T{100});
+  EXPECT_GT(zm.min(2), zm.max(2));
+  for (std::size_t z = 0; z < nz; ++z)
+    EXPECT_EQ(zm.may_contain(z, T{0}, T{120}), z != 2 && z < 5) << z;
+}
+
+} // tjg_test